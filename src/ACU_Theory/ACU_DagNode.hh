@@ -92,6 +92,8 @@ private:
     CONVERT_THRESHOLD = 8,
     MERGE_THRESHOLD = 16,
 #endif
+    TREE_INSERT_RATIO = 8,		// size ratio at which we insert into a tree rather than merge
+    GALLOP_RATIO = 8,			// size ratio at which we gallop through an argArray rather than merge
 
     INITIAL_RUNS_BUFFER_SIZE = 4	// must be > 0
   };
@@ -120,6 +122,12 @@ private:
   void fastMerge(const ACU_DagNode* source0, const ACU_DagNode* source1);
   void fastMerge(const ACU_DagNode* source0, const ACU_TreeDagNode* source1);
   void fastMerge(const ACU_TreeDagNode* source0, const ACU_TreeDagNode* source1);
+  bool insertIntoTree(const ACU_DagNode* source0, const ACU_TreeDagNode* source1);
+  bool insertIntoTree(const ACU_TreeDagNode* source0, const ACU_TreeDagNode* source1);
+  void gallopingMerge(const ACU_DagNode* small, const ACU_DagNode* big);
+  static ArgVec<Pair>::const_iterator gallop(ArgVec<Pair>::const_iterator i,
+					     ArgVec<Pair>::const_iterator e,
+					     DagNode* key);
 
   void sortAndUniquize();
   void flattenSortAndUniquize(int expansion);
@@ -151,14 +151,35 @@ ACU_DagNode::eliminateSubject(DagNode* target,
     return true;
   if (target->symbol() == topSymbol)
     {
+      //
+      //	The arguments of target will normally be in the same order as ours
+      //	so rather than binary searching all our arguments for each one we
+      //	gallop forward from where we found the previous one, falling back
+      //	on a full binary search if that fails.
+      //
       ArgVec<Pair>& args = getACU_DagNode(target)->argArray;
       int nrArgs = args.length();
+      const ArgVec<Pair>::const_iterator b = argArray.begin();
+      const ArgVec<Pair>::const_iterator e = argArray.end();
+      ArgVec<Pair>::const_iterator start = b;
       for (int i = 0; i < nrArgs; i++)
         {
           DagNode* d = args[i].dagNode;
           int m = args[i].multiplicity;
-	  int pos = binarySearch(d);
-          if (pos < 0 || (subjectMultiplicity[pos] -= m * multiplicity) < 0)
+	  ArgVec<Pair>::const_iterator p = gallop(start, e, d);
+	  int pos;
+	  if (p != e && d->equal(p->dagNode))
+	    {
+	      pos = p - b;
+	      start = p + 1;
+	    }
+	  else
+	    {
+	      pos = binarySearch(d);
+	      if (pos < 0)
+		return false;
+	    }
+          if ((subjectMultiplicity[pos] -= m * multiplicity) < 0)
             return false;
         }
     }
@@ -34,8 +34,19 @@ ACU_DagNode::fastMerge(const ACU_DagNode* source0,
   //
   //	Merge the argArrays from source0 and source1 into our argArray.
   //
-  argArray.resizeWithoutPreservation(source0->argArray.length() +
-				     source1->argArray.length());
+  int nrArgs0 = source0->argArray.length();
+  int nrArgs1 = source1->argArray.length();
+  if (nrArgs0 * GALLOP_RATIO <= nrArgs1)
+    {
+      gallopingMerge(source0, source1);
+      return;
+    }
+  if (nrArgs1 * GALLOP_RATIO <= nrArgs0)
+    {
+      gallopingMerge(source1, source0);
+      return;
+    }
+  argArray.resizeWithoutPreservation(nrArgs0 + nrArgs1);
   
   ArgVec<Pair>::const_iterator s0 = source0->argArray.begin();
   const ArgVec<Pair>::const_iterator e0 = source0->argArray.end();
@@ -204,3 +215,73 @@ ACU_DagNode::fastMerge(const ACU_TreeDagNode* source0,
     }
   argArray.contractTo(d - argArray.begin());
 }
+
+void
+ACU_DagNode::gallopingMerge(const ACU_DagNode* small, const ACU_DagNode* big)
+{
+  //
+  //	Merge a small argArray into a much bigger one. Rather than comparing
+  //	every argument of big, we gallop over the runs of big that lie between
+  //	successive arguments of small and copy them in bulk; this takes
+  //	O(k log(n/k)) comparisons rather than O(n + k).
+  //
+  argArray.resizeWithoutPreservation(small->argArray.length() +
+				     big->argArray.length());
+  ArgVec<Pair>::const_iterator b = big->argArray.begin();
+  const ArgVec<Pair>::const_iterator e = big->argArray.end();
+  ArgVec<Pair>::iterator d = argArray.begin();
+  const ArgVec<Pair>::const_iterator e0 = small->argArray.end();
+  for (ArgVec<Pair>::const_iterator s = small->argArray.begin(); s != e0; ++s)
+    {
+      DagNode* key = s->dagNode;
+      ArgVec<Pair>::const_iterator p = gallop(b, e, key);
+      d = fastCopy(b, p, d);
+      if (p != e && key->equal(p->dagNode))
+	{
+	  d->dagNode = p->dagNode;
+	  d->multiplicity = p->multiplicity + s->multiplicity;
+	  ++p;
+	}
+      else
+	*d = *s;
+      ++d;
+      b = p;
+    }
+  d = fastCopy(b, e, d);
+  argArray.contractTo(d - argArray.begin());
+}
+
+ArgVec<ACU_DagNode::Pair>::const_iterator
+ACU_DagNode::gallop(ArgVec<Pair>::const_iterator i,
+		    ArgVec<Pair>::const_iterator e,
+		    DagNode* key)
+{
+  //
+  //	Return the first argument in [i, e) that is not less than key. We
+  //	probe i[0], i[2], i[6], i[14], ... to find a range that must contain it
+  //	and then binary search that range, so finding a position k arguments
+  //	along takes O(log k) comparisons.
+  //
+  int length = e - i;
+  int lower = 0;  // arguments before lower are known to be less than key
+  int upper = 0;
+  for (int step = 2; upper < length && i[upper].dagNode->compare(key) < 0; step *= 2)
+    {
+      lower = upper + 1;
+      upper += step;
+    }
+  if (upper > length)
+    upper = length;
+  //
+  //	Now upper is either length or the index of an argument not less than key.
+  //
+  while (lower < upper)
+    {
+      int probe = (lower + upper) / 2;
+      if (i[probe].dagNode->compare(key) < 0)
+	lower = probe + 1;
+      else
+	upper = probe;
+    }
+  return i + lower;
+}
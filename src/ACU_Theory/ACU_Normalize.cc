@@ -133,6 +133,52 @@ ACU_DagNode::insertAlien(ACU_BaseDagNode* normalForm,
     }
 }      
 
+bool
+ACU_DagNode::insertIntoTree(const ACU_DagNode* source0, const ACU_TreeDagNode* source1)
+{
+  //
+  //	If source0 is small compared to the red-black tree in source1, it is
+  //	much cheaper to insert its arguments into the persistent tree, copying
+  //	O(log n) tree nodes per argument, than to merge everything into our
+  //	argArray and then rebuild a tree from it. Returns true if we did this,
+  //	in which case we become an ACU_TreeDagNode.
+  //
+  const ACU_Tree& tree1 = source1->getTree();
+  int nrArgs0 = source0->argArray.length();
+  if (nrArgs0 * TREE_INSERT_RATIO > tree1.getSize())
+    return false;
+
+  ACU_Tree t = tree1;
+  const ArgVec<Pair>::const_iterator e0 = source0->argArray.end();
+  for (ArgVec<Pair>::const_iterator i = source0->argArray.begin(); i != e0; ++i)
+    t.insertMult(i->dagNode, i->multiplicity);
+  (void) new (this) ACU_TreeDagNode(symbol(), t);
+  return true;
+}
+
+bool
+ACU_DagNode::insertIntoTree(const ACU_TreeDagNode* source0, const ACU_TreeDagNode* source1)
+{
+  //
+  //	As above, but for two red-black trees; we insert the arguments of the
+  //	smaller into the larger.
+  //
+  const ACU_Tree& tree0 = source0->getTree();
+  const ACU_Tree& tree1 = source1->getTree();
+  int size0 = tree0.getSize();
+  int size1 = tree1.getSize();
+  if (size0 > size1)
+    return insertIntoTree(source1, source0);
+  if (size0 * TREE_INSERT_RATIO > size1)
+    return false;
+
+  ACU_Tree t = tree1;
+  for (ACU_FastIter i(tree0); i.valid(); i.next())
+    t.insertMult(i.getDagNode(), i.getMultiplicity());
+  (void) new (this) ACU_TreeDagNode(symbol(), t);
+  return true;
+}
+
 bool
 ACU_DagNode::normalizeAtTop()
 {
@@ -296,14 +342,26 @@ ACU_DagNode::normalizeAtTop()
 		  if (b0->isTree())
 		    {
 		      if (b1->isTree())
-			fastMerge(safeCast(ACU_TreeDagNode*, d0), safeCast(ACU_TreeDagNode*, d1));
+			{
+			  if (insertIntoTree(safeCast(ACU_TreeDagNode*, d0), safeCast(ACU_TreeDagNode*, d1)))
+			    return false;
+			  fastMerge(safeCast(ACU_TreeDagNode*, d0), safeCast(ACU_TreeDagNode*, d1));
+			}
 		      else
-			fastMerge(safeCast(ACU_DagNode*, d1), safeCast(ACU_TreeDagNode*, d0));
+			{
+			  if (insertIntoTree(safeCast(ACU_DagNode*, d1), safeCast(ACU_TreeDagNode*, d0)))
+			    return false;
+			  fastMerge(safeCast(ACU_DagNode*, d1), safeCast(ACU_TreeDagNode*, d0));
+			}
 		    }
 		  else
 		    {
 		      if (b1->isTree())
-			fastMerge(safeCast(ACU_DagNode*, d0), safeCast(ACU_TreeDagNode*, d1));
+			{
+			  if (insertIntoTree(safeCast(ACU_DagNode*, d0), safeCast(ACU_TreeDagNode*, d1)))
+			    return false;
+			  fastMerge(safeCast(ACU_DagNode*, d0), safeCast(ACU_TreeDagNode*, d1));
+			}
 		      else
 			fastMerge(safeCast(ACU_DagNode*, d0), safeCast(ACU_DagNode*, d1));
 		    }
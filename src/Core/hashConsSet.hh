@@ -58,6 +58,11 @@ public:
   //	Returns the canonical dag node for the index.
   //
   DagNode* getCanonical(int index) const;
+  //
+  //	Size and wholesale flushing.
+  //
+  using PointerSet::cardinality;
+  using PointerSet::makeEmpty;
 
 private:
   //
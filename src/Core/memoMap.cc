@@ -35,9 +35,13 @@
 //      core class definitions"
 #include "memoMap.hh"
 
-int
+int MemoMap::maxSize = NONE;
+
+MemoMap::Index
 MemoMap::getFromIndex(DagNode* fromDag)
 {
+  if (maxSize != NONE && dags.cardinality() >= maxSize)
+    flush();
   //
   //	We assume that a fromDag is unreduced and therefore we never use
   //	the original in the hash cons table incase it is reduced in place.
@@ -50,5 +54,38 @@ MemoMap::getFromIndex(DagNode* fromDag)
       for (int i = nrFromDags; i <= fromIndex; ++i)
 	toIndices[i] = NONE;
     }
-  return fromIndex;
+  return firstIndex + fromIndex;
+}
+
+void
+MemoMap::flush()
+{
+  //
+  //	Hash cons'd entries share subdags so we can't evict individual
+  //	entries; instead we start a new generation. Dags that are no
+  //	longer in use will be reclaimed by the garbage collector.
+  //
+  DebugAdvisory("flushing memo map with " << dags.cardinality() << " dags");
+  firstIndex += toIndices.size();
+  dags.makeEmpty();
+  toIndices.clear();
+  ++nrFlushes;
+}
+
+void
+MemoMap::showStatistics(ostream& s) const
+{
+  s << "memo table hits: " << nrHits <<
+    "\tmisses: " << nrMisses <<
+    "\tflushes: " << nrFlushes <<
+    "\tdags: " << dags.cardinality() << '\n';
+}
+
+void
+MemoMap::showStatisticsJson(ostream& s) const
+{
+  s << "{\"hits\": " << nrHits <<
+    ", \"misses\": " << nrMisses <<
+    ", \"flushes\": " << nrFlushes <<
+    ", \"dags\": " << dags.cardinality() << '}';
 }
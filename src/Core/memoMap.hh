@@ -30,27 +30,102 @@
 
 class MemoMap
 {
+  NO_COPYING(MemoMap);
+
 public:
-  int getFromIndex(DagNode* fromDag);
-  DagNode* getToDag(int fromIndex) const;
-  void assignToDag(int fromIndex, DagNode* toDag);
+  //
+  //	From-indices keep increasing across flushes so that a source set
+  //	collected before a flush can't refer to a dag entered after it.
+  //
+  typedef Int64 Index;
+
+  MemoMap();
+
+  Index getFromIndex(DagNode* fromDag);
+  DagNode* getToDag(Index fromIndex);
+  void assignToDag(Index fromIndex, DagNode* toDag);
+  void showStatistics(ostream& s) const;
+  void showStatisticsJson(ostream& s) const;
+  //
+  //	Entries of the current generation; an entry whose from-dag
+  //	has no to-dag yet returns false.
+  //
+  int getNrEntries() const;
+  bool getEntry(int entryNr, DagNode*& fromDag, DagNode*& toDag) const;
+  //
+  //	Flush threshold on the number of dags (including subdags) a memo map
+  //	holds; NONE means never flush. We check it before each new from-dag
+  //	is inserted, so a map can end up somewhat above the threshold by the
+  //	subdags of its latest entries.
+  //
+  static void setMaxSize(int nrDags);
 
 private:
+  void flush();
+
+  static int maxSize;
+
   HashConsSet dags;
   Vector<int> toIndices;  // maps from-indices to to-indices
+  Index firstIndex;  // from-index of local index 0 in current generation
+  Int64 nrHits;
+  Int64 nrMisses;
+  Int64 nrFlushes;
 };
 
+inline
+MemoMap::MemoMap()
+{
+  firstIndex = 0;
+  nrHits = 0;
+  nrMisses = 0;
+  nrFlushes = 0;
+}
+
 inline DagNode*
-MemoMap::getToDag(int fromIndex) const
+MemoMap::getToDag(Index fromIndex)
+{
+  int toIndex = toIndices[fromIndex - firstIndex];
+  if (toIndex == NONE)
+    {
+      ++nrMisses;
+      return 0;
+    }
+  ++nrHits;
+  return dags.getCanonical(toIndex);
+}
+
+inline void
+MemoMap::assignToDag(Index fromIndex, DagNode* toDag)
+{
+  //
+  //	A from-index from before the last flush has nothing to refer to.
+  //
+  if (fromIndex >= firstIndex)
+    toIndices[fromIndex - firstIndex] = dags.insert(toDag);
+}
+
+inline int
+MemoMap::getNrEntries() const
+{
+  return toIndices.size();
+}
+
+inline bool
+MemoMap::getEntry(int entryNr, DagNode*& fromDag, DagNode*& toDag) const
 {
-  int toIndex = toIndices[fromIndex];
-  return toIndex == NONE ? 0 : dags.getCanonical(toIndex);
+  int toIndex = toIndices[entryNr];
+  if (toIndex == NONE)
+    return false;
+  fromDag = dags.getCanonical(entryNr);
+  toDag = dags.getCanonical(toIndex);
+  return true;
 }
 
 inline void
-MemoMap::assignToDag(int fromIndex, DagNode* toDag)
+MemoMap::setMaxSize(int nrDags)
 {
-  toIndices[fromIndex] = dags.insert(toDag);
+  maxSize = nrDags;
 }
 
 #endif
@@ -51,7 +51,7 @@ MemoTable::memoRewrite(SourceSet& sourceSet, DagNode* subject, RewritingContext&
 		" has sort index " << subject->getSortIndex());
 #endif
   MemoMap* memoMap = getModule()->getMemoMap();
-  int subjectIndex = memoMap->getFromIndex(subject);
+  MemoMap::Index subjectIndex = memoMap->getFromIndex(subject);
 
   if (DagNode* toDag = memoMap->getToDag(subjectIndex))
     {
@@ -86,6 +86,6 @@ MemoTable::memoEnter(SourceSet& sourceSet, DagNode* destination)
 		" has sort index " << destination->getSortIndex());
 #endif
   MemoMap* memoMap = getModule()->getMemoMap();
-  for (int index : sourceSet)
+  for (MemoMap::Index index : sourceSet)
     memoMap->assignToDag(index, destination);
 }
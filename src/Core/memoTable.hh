@@ -33,7 +33,7 @@
 class MemoTable : public ModuleItem
 {
 public:
-  typedef Vector<int> SourceSet;
+  typedef Vector<Int64> SourceSet;  // of MemoMap::Index
 
   MemoTable(bool memoFlag);
 
@@ -25,6 +25,9 @@
 //
 #include "cmath"
 #include <sys/resource.h>
+#ifndef NO_ASSERT
+#include <thread>
+#endif
 
 //	utility stuff
 #include "macros.hh"
@@ -65,6 +68,9 @@ MemoryCell::Arena::firstNode()
 bool MemoryCell::showGC = false;
 bool MemoryCell::showResourcesFlag = false;
 int_fast64_t MemoryCell::earlyQuit = 0;
+double MemoryCell::minimumSlopFactor = 0.0;
+bool MemoryCell::idleCollection = false;
+int_fast64_t MemoryCell::gcCount = 0;
 
 //
 //	Arena management variables.
@@ -72,6 +78,7 @@ int_fast64_t MemoryCell::earlyQuit = 0;
 int MemoryCell::nrArenas = 0;
 bool MemoryCell::currentArenaPastActiveArena = true;
 bool MemoryCell::needToCollectGarbage = false;
+int MemoryCell::nrArenasPassed = 0;
 MemoryCell::Arena* MemoryCell::firstArena = 0;
 MemoryCell::Arena* MemoryCell::lastArena = 0;
 MemoryCell::Arena* MemoryCell::currentArena = 0;
@@ -84,6 +91,7 @@ MemoryCell* MemoryCell::lastActiveNode = 0;
 //
 int MemoryCell::nrBuckets = 0;
 MemoryCell::Bucket* MemoryCell::bucketList = 0;
+MemoryCell::Bucket* MemoryCell::fullList = 0;
 MemoryCell::Bucket* MemoryCell::unusedList = 0;
 size_t MemoryCell::bucketStorage = 0;
 size_t MemoryCell::storageInUse = 0;
@@ -110,6 +118,20 @@ MemoryCell::memConvert(uint_fast64_t nrBytes)
   return {value, "KB"};
 }
 
+#ifndef NO_ASSERT
+bool
+MemoryCell::onOwnerThread()
+{
+  //
+  //	Nothing in the allocator is protected by a lock, so the first thread to
+  //	come through one of the slow paths becomes the owner and all later
+  //	allocation and garbage collection must happen on it.
+  //
+  static const std::thread::id owner = std::this_thread::get_id();
+  return owner == std::this_thread::get_id();
+}
+#endif
+
 MemoryCell::Arena*
 MemoryCell::allocateNewArena()
 {
@@ -138,6 +160,7 @@ MemoryCell::slowNew()
   cerr << "slowNew()\n";
   dumpMemoryVariables(cerr);
 #endif
+  Assert(onOwnerThread(), "dag node allocated off the allocator's thread");
   for(;;)
     {
       if (currentArena == 0)
@@ -171,6 +194,7 @@ MemoryCell::slowNew()
 	      //
 	      if (currentArena == lastActiveArena)
 		currentArenaPastActiveArena = true;
+	      ++nrArenasPassed;
 	      currentArena = allocateNewArena();
 	      MemoryCell* d = currentArena->firstNode();
 	      endPointer = d + ARENA_SIZE;
@@ -185,6 +209,7 @@ MemoryCell::slowNew()
 	  //
 	  if (currentArena == lastActiveArena)
 	    currentArenaPastActiveArena = true;
+	  ++nrArenasPassed;
 	  currentArena = a;
 	  nextNode = a->firstNode();
 	  endPointer = nextNode +
@@ -216,7 +241,50 @@ MemoryCell::slowNew()
 void*
 MemoryCell::slowAllocateStorage(size_t bytesNeeded)
 {
+  Assert(onOwnerThread(), "storage allocated off the allocator's thread");
+  //
+  //	The current bucket didn't have room. Look for another in use bucket
+  //	that does, retiring nearly full ones along the way so that they
+  //	are not searched again before the next garbage collection.
+  //
   Bucket* p = 0;
+  for (Bucket* b = bucketList; b;)
+    {
+      Bucket* n = b->nextBucket;
+      if (b->bytesFree >= bytesNeeded)
+	{
+	  if (p != 0)
+	    {
+	      //
+	      //	Make b the current bucket.
+	      //
+	      p->nextBucket = n;
+	      b->nextBucket = bucketList;
+	      bucketList = b;
+	    }
+	  b->bytesFree -= bytesNeeded;
+	  void* t = b->nextFree;
+	  b->nextFree = static_cast<char*>(t) + bytesNeeded;
+	  return t;
+	}
+      if (b->bytesFree < FULL_BUCKET_SLACK)
+	{
+	  //
+	  //	Move b from bucket list to full list.
+	  //
+	  if (p == 0)
+	    bucketList = n;
+	  else
+	    p->nextBucket = n;
+	  b->nextBucket = fullList;
+	  fullList = b;
+	}
+      else
+	p = b;
+      b = n;
+    }
+
+  p = 0;
   for (Bucket* b = unusedList; b; p = b, b = b->nextBucket)
     {
       if (b->bytesFree >= bytesNeeded)
@@ -326,10 +394,9 @@ MemoryCell::tidyArenas()
 void
 MemoryCell::collectGarbage()
 {
-  static int_fast64_t gcCount = 0;
-
   if (firstArena == 0)
     return;
+  Assert(onOwnerThread(), "garbage collection requested off the allocator's thread");
   tidyArenas();
 #ifdef GC_DEBUG
   checkArenas();
@@ -340,19 +407,32 @@ MemoryCell::collectGarbage()
   nrNodesInUse = 0;
   size_t oldStorageInUse = storageInUse;
   Bucket* b = bucketList;
+  Bucket* f = fullList;
   bucketList = unusedList;
+  fullList = 0;
   unusedList = 0;
   storageInUse = 0;
 
   RootContainer::markPhase();
-
+  //
+  //	Everything that was in use before the mark phase is now unused.
+  //
+  for (Bucket* n; f; f = n)
+    {
+      n = f->nextBucket;
+      f->nextBucket = b;
+      b = f;
+    }
   unusedList = b;
   for (; b; b = b->nextBucket)
     {
       b->bytesFree = b->nrBytes;
       b->nextFree = b + 1;  // reset
     }
-  size_t newTarget = TARGET_MULTIPLIER * storageInUse;
+  double targetMultiplier = TARGET_MULTIPLIER;
+  if (targetMultiplier < minimumSlopFactor)
+    targetMultiplier = minimumSlopFactor;
+  size_t newTarget = targetMultiplier * storageInUse;
   if (target < newTarget)
     target = newTarget;
   //
@@ -388,6 +468,8 @@ MemoryCell::collectGarbage()
     slopFactor = SMALL_MODEL_SLOP;  // if we are using few nodes
   else if (nrNodesInUse < UPPER_BOUND)
     slopFactor += ((UPPER_BOUND - nrNodesInUse) * (SMALL_MODEL_SLOP - BIG_MODEL_SLOP)) / (UPPER_BOUND - LOWER_BOUND);
+  if (slopFactor < minimumSlopFactor)
+    slopFactor = minimumSlopFactor;  // user wants fewer, bigger collections
   //
   //	Allocate new arenas so that we have at least slopFactor times the actually used nodes.
   //
@@ -403,6 +485,7 @@ MemoryCell::collectGarbage()
   endPointer = nextNode +
     ((firstArena->nextArena != 0) ? ARENA_SIZE : ARENA_SIZE - RESERVE_SIZE);
   needToCollectGarbage = false;
+  nrArenasPassed = 0;
 #ifdef GC_DEBUG
   // stompArenas();
   cerr << "end of GC\n";
@@ -410,6 +493,25 @@ MemoryCell::collectGarbage()
 #endif
 }
 
+void
+MemoryCell::idleCollectGarbage()
+{
+  //
+  //	We collect if a garbage collection is already wanted or we have
+  //	used at least half of our node or bucket budget since the last one.
+  //
+  if (idleCollection &&
+      (needToCollectGarbage ||
+       2 * nrArenasPassed >= nrArenas ||
+       2 * storageInUse >= target))
+    {
+      DebugAdvisory("idle garbage collection: nrArenasPassed = " << nrArenasPassed <<
+		    " nrArenas = " << nrArenas <<
+		    " storageInUse = " << storageInUse << " target = " << target);
+      collectGarbage();
+    }
+}
+
 void
 MemoryCell::showResources(ostream& s)
 {
@@ -426,6 +528,23 @@ MemoryCell::showResources(ostream& s)
     }
   else
     CantHappen("getrusage() failed: " << strerror(errno));
+  //
+  //	Bucket occupancy.
+  //
+  int nrActive = 0;
+  for (Bucket* b = bucketList; b; b = b->nextBucket)
+    ++nrActive;
+  int nrFull = 0;
+  for (Bucket* b = fullList; b; b = b->nextBucket)
+    ++nrFull;
+  pair<double, const char*> bp = memConvert(bucketStorage);
+  pair<double, const char*> up = memConvert(storageInUse);
+  pair<double, const char*> tp = memConvert(target);
+  s << "Buckets: " << nrBuckets << " (" << nrActive << " active / " << nrFull << " full / " <<
+    nrBuckets - nrActive - nrFull << " unused)" <<
+    "\tBytes: " << bp.first << " " << bp.second <<
+    "\tIn use: " << up.first << " " << up.second <<
+    "\tTarget: " << tp.first << " " << tp.second << endl;
 }
 
 #ifdef GC_DEBUG
@@ -58,16 +58,39 @@ public:
   //
   static bool wantToCollectGarbage();
   static void collectGarbage();
+  //
+  //	When we are about to sit idle, waiting on external events, we can bring
+  //	forward a garbage collection that is due soon so that its pause doesn't
+  //	land in the middle of later work. Caller must ensure that all the
+  //	non-garbage is accessible via root pointers.
+  //
+  static void idleCollectGarbage();
+  static void setIdleCollection(bool polarity);
 
   static void setShowGC(bool polarity);
   static void setEarlyQuit(int_fast64_t count);
   //
+  //	Long running computations with a large, long lived heap spend much of
+  //	their time re-marking the same survivors. Raising the minimum slop
+  //	factor trades memory for fewer garbage collections.
+  //
+  static void setMinimumSlopFactor(double factor);
+  //
   //	We put this here because we want to do it potentially every garbage collect.
   //
   static void setShowResources(bool polarity);
+  static bool getShowResources();
   static void maybeShowResources();
   static void showResources(ostream& s);
   //
+  //	Raw garbage collector statistics for machine-readable reports.
+  //
+  static int_fast64_t getGcCount();
+  static int getNrArenas();
+  static size_t getNrNodes();
+  static size_t getBucketStorage();
+  static size_t getStorageInUse();
+  //
   //	We provide functions for getting access to the MemoryInfo object
   //	corresponding the a memory block we allocated.
   //
@@ -83,7 +106,8 @@ private:
     BUCKET_MULTIPLIER = 8,	// to determine bucket size for huge allocations
     MIN_BUCKET_SIZE = 256 * 1024 - 8,	// bucket size for normal allocations
     INITIAL_TARGET = 220 * 1024,	// just under 8/9 of MIN_BUCKET_SIZE
-    TARGET_MULTIPLIER = 8	// to determine bucket usage target
+    TARGET_MULTIPLIER = 8,	// to determine bucket usage target
+    FULL_BUCKET_SLACK = 1024	// buckets with less free space are no longer searched
   };
 
   struct Arena;			// arena of fixed size nodes
@@ -94,16 +118,28 @@ private:
   static MemoryCell* slowNew();
   static void* slowAllocateStorage(size_t bytesNeeded);
   static pair<double, const char*> memConvert(uint_fast64_t nrBytes);
+#ifndef NO_ASSERT
+  static bool onOwnerThread();
+#endif
   
   static bool showGC;			// do we report GC stats to user
   static bool showResourcesFlag;	// do we report resource usage to the user
   static int_fast64_t earlyQuit;	// do we quit early for profiling purposes
+  static double minimumSlopFactor;	// lower bound on heap size / live data after GC
+  static bool idleCollection;		// do we collect early when idle
+  static int_fast64_t gcCount;		// number of garbage collections so far
   //
   //	Arena management variables.
   //
+  //	These, together with the bucket management variables below and the
+  //	RootContainer list, are process-wide and unsynchronized. Allocation and
+  //	garbage collection are therefore confined to a single thread; debug
+  //	builds check this on the slow paths.
+  //
   static int nrArenas;
   static bool currentArenaPastActiveArena;
   static bool needToCollectGarbage;
+  static int nrArenasPassed;		// arenas swept or allocated since last GC
   static Arena* firstArena;
   static Arena* lastArena;
   static Arena* currentArena;
@@ -115,7 +151,8 @@ private:
   //	Bucket management variables.
   //
   static int nrBuckets;		// total number of buckets
-  static Bucket* bucketList;	// linked list of "in use" buckets
+  static Bucket* bucketList;	// linked list of "in use" buckets; first is current
+  static Bucket* fullList;	// linked list of "in use" buckets too full to search
   static Bucket* unusedList;	// linked list of unused buckets
   static size_t bucketStorage;	// total amount of bucket storage (bytes)
   static size_t storageInUse;	// amount of bucket storage in use (bytes)
@@ -158,15 +195,16 @@ MemoryCell::allocateStorage(size_t bytesNeeded)
   storageInUse += bytesNeeded;
   if (storageInUse > target)
     needToCollectGarbage = true;
-  for (Bucket* b = bucketList; b; b = b->nextBucket)
+  //
+  //	Bump allocate from the current bucket if it has room.
+  //
+  Bucket* b = bucketList;
+  if (b != 0 && b->bytesFree >= bytesNeeded)
     {
-      if (b->bytesFree >= bytesNeeded)
-	{
-	  b->bytesFree -= bytesNeeded;
-	  void* t = b->nextFree;
-	  b->nextFree = static_cast<char*>(t) + bytesNeeded;
-	  return t;
-	}
+      b->bytesFree -= bytesNeeded;
+      void* t = b->nextFree;
+      b->nextFree = static_cast<char*>(t) + bytesNeeded;
+      return t;
     }
   return slowAllocateStorage(bytesNeeded);
 }
@@ -177,12 +215,60 @@ MemoryCell::setShowGC(bool polarity)
   showGC = polarity;
 }
 
+inline void
+MemoryCell::setIdleCollection(bool polarity)
+{
+  idleCollection = polarity;
+}
+
+inline void
+MemoryCell::setMinimumSlopFactor(double factor)
+{
+  minimumSlopFactor = factor;
+}
+
 inline void
 MemoryCell::setShowResources(bool polarity)
 {
   showResourcesFlag = polarity;
 }
 
+inline bool
+MemoryCell::getShowResources()
+{
+  return showResourcesFlag;
+}
+
+inline int_fast64_t
+MemoryCell::getGcCount()
+{
+  return gcCount;
+}
+
+inline int
+MemoryCell::getNrArenas()
+{
+  return nrArenas;
+}
+
+inline size_t
+MemoryCell::getNrNodes()
+{
+  return static_cast<size_t>(nrArenas) * ARENA_SIZE;
+}
+
+inline size_t
+MemoryCell::getBucketStorage()
+{
+  return bucketStorage;
+}
+
+inline size_t
+MemoryCell::getStorageInUse()
+{
+  return storageInUse;
+}
+
 inline void
 MemoryCell::maybeShowResources()
 {
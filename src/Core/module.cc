@@ -42,6 +42,7 @@
 #include "rule.hh"
 #include "sortBdds.hh"
 #include "memoMap.hh"
+#include "unifierCache.hh"
 #include "module.hh"
 #include "strategyDefinition.hh"
 #include "rewriteStrategy.hh"
@@ -56,6 +57,7 @@ Module::Module(int id)
   sortBdds = 0;
   minimumSubstitutionSize = 1;
   memoMap = 0;
+  unifierCache = 0;
 }
 
 Module::~Module()
@@ -67,6 +69,7 @@ Module::~Module()
   //	dag nodes that might contain pointers to our symbols.
   //
   clearMemo();
+  delete unifierCache;
   reset();
   //
   //	Then we delete everything except for the symbols.
@@ -527,6 +530,46 @@ Module::getMemoMap()
   return memoMap;
 }
 
+void
+Module::showMemoStatistics(ostream& s) const
+{
+  if (memoMap != 0)
+    memoMap->showStatistics(s);
+}
+
+void
+Module::showMemoStatisticsJson(ostream& s) const
+{
+  if (memoMap != 0)
+    memoMap->showStatisticsJson(s);
+  else
+    s << "null";
+}
+
+UnifierCache*
+Module::getUnifierCache()
+{
+  if (unifierCache == 0 && UnifierCache::isEnabled())
+    unifierCache = new UnifierCache;
+  return unifierCache;
+}
+
+void
+Module::showUnifierCacheStatistics(ostream& s) const
+{
+  if (unifierCache != 0)
+    unifierCache->showStatistics(s);
+}
+
+void
+Module::showUnifierCacheStatisticsJson(ostream& s) const
+{
+  if (unifierCache != 0)
+    unifierCache->showStatisticsJson(s);
+  else
+    s << "null";
+}
+
 void
 Module::reset()
 {
@@ -93,7 +93,16 @@ public:
   //	Memoization stuff.
   //
   MemoMap* getMemoMap();
+  bool hasMemoMap() const;
   void clearMemo();
+  void showMemoStatistics(ostream& s) const;
+  void showMemoStatisticsJson(ostream& s) const;
+  //
+  //	Caching of variant narrowing unifiers; returns 0 if caching is disabled.
+  //
+  UnifierCache* getUnifierCache();
+  void showUnifierCacheStatistics(ostream& s) const;
+  void showUnifierCacheStatisticsJson(ostream& s) const;
 
 #ifdef DUMP
   void dump(ostream& s);
@@ -118,6 +127,7 @@ private:
   SortBdds* sortBdds;
   int minimumSubstitutionSize;
   MemoMap* memoMap;  // global memo map for all symbols in module
+  UnifierCache* unifierCache;
 };
 
 inline Environment*
@@ -132,6 +142,12 @@ Module::getStatus() const
   return status;
 }
 
+inline bool
+Module::hasMemoMap() const
+{
+  return memoMap != 0;
+}
+
 inline const Vector<Sort*>&
 Module::getSorts() const
 {
@@ -0,0 +1,167 @@
+/*
+
+    This file is part of the Maude 3 interpreter.
+
+    Copyright 2026 SRI International, Menlo Park, CA 94025, USA.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.
+
+*/
+
+//
+//      Implementation for class UnifierCache.
+//
+
+//	utility stuff
+#include "macros.hh"
+#include "vector.hh"
+
+//      forward declarations
+#include "interface.hh"
+#include "core.hh"
+
+//	interface class definitions
+#include "dagNode.hh"
+
+//      core class definitions
+#include "substitution.hh"
+#include "unifierCache.hh"
+
+int UnifierCache::maxSize = 50000;
+
+UnifierCache::~UnifierCache()
+{
+  for (Entry& e : entries)
+    discardUnifiers(e);
+}
+
+UnifierCache::Index
+UnifierCache::getEntry(const Vector<DagNode*>& keyDags, Vector<int>& key)
+{
+  if (entries.length() + nrUnifiers >= maxSize)
+    flush();
+  //
+  //	The dags in a problem may be reduced or normalized in place by our
+  //	caller so we never use the originals in the hash cons table.
+  //
+  for (DagNode* d : keyDags)
+    key.append(dags.insertCopy(d));
+  int nrEntries = entries.length();
+  pair<EntryMap::iterator, bool> p = entryMap.insert(EntryMap::value_type(key, nrEntries));
+  if (p.second)
+    {
+      entries.expandBy(1);
+      Entry& e = entries[nrEntries];
+      e.complete = false;
+    }
+  else
+    {
+      Entry& e = entries[p.first->second];
+      if (e.complete)
+	{
+	  ++nrHits;
+	  return firstIndex + p.first->second;
+	}
+      //
+      //	An earlier problem with this key was abandoned before all its
+      //	unifiers were generated, or was incomplete; throw away what it
+      //	recorded and start over.
+      //
+      discardUnifiers(e);
+    }
+  ++nrMisses;
+  return firstIndex + p.first->second;
+}
+
+void
+UnifierCache::addUnifier(Index index, const Substitution& unifier, int nrFreeVariables)
+{
+  //
+  //	An index from before the last flush has nothing to refer to.
+  //
+  if (index >= firstIndex)
+    {
+      Entry& e = entries[index - firstIndex];
+      Assert(!e.complete, "adding unifier to complete entry");
+      Substitution* s = new Substitution(unifier.nrFragileBindings());
+      s->clone(unifier);
+      e.unifiers.append(s);
+      e.nrFreeVariables.append(nrFreeVariables);
+      ++nrUnifiers;
+    }
+}
+
+void
+UnifierCache::discardUnifiers(Entry& entry)
+{
+  for (Substitution* s : entry.unifiers)
+    delete s;
+  nrUnifiers -= entry.unifiers.size();
+  entry.unifiers.clear();
+  entry.nrFreeVariables.clear();
+}
+
+void
+UnifierCache::flush()
+{
+  //
+  //	As with memo maps, keys share hash cons'd subdags so we start a new
+  //	generation rather than evicting individual entries.
+  //
+  DebugAdvisory("flushing unifier cache with " << entries.length() <<
+		" entries and " << nrUnifiers << " unifiers");
+  firstIndex += entries.length();
+  for (Entry& e : entries)
+    discardUnifiers(e);
+  entries.clear();
+  entryMap.clear();
+  dags.makeEmpty();
+  ++nrFlushes;
+}
+
+void
+UnifierCache::markReachableNodes()
+{
+  for (const Entry& e : entries)
+    {
+      for (const Substitution* s : e.unifiers)
+	{
+	  int nrBindings = s->nrFragileBindings();
+	  for (int i = 0; i < nrBindings; ++i)
+	    {
+	      if (DagNode* d = s->value(i))
+		d->mark();
+	    }
+	}
+    }
+}
+
+void
+UnifierCache::showStatistics(ostream& s) const
+{
+  s << "unifier cache hits: " << nrHits <<
+    "\tmisses: " << nrMisses <<
+    "\tflushes: " << nrFlushes <<
+    "\tunifiers: " << nrUnifiers << '\n';
+}
+
+void
+UnifierCache::showStatisticsJson(ostream& s) const
+{
+  s << "{\"hits\": " << nrHits <<
+    ", \"misses\": " << nrMisses <<
+    ", \"flushes\": " << nrFlushes <<
+    ", \"unifiers\": " << nrUnifiers << '}';
+}
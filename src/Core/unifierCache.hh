@@ -0,0 +1,154 @@
+/*
+
+    This file is part of the Maude 3 interpreter.
+
+    Copyright 2026 SRI International, Menlo Park, CA 94025, USA.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.
+
+*/
+
+//
+//      Class for a bounded cache of complete unifier sets, indexed by the
+//	unification problem that produced them.
+//
+//	A problem is described by a vector of ints supplied by the caller
+//	together with a vector of dags which are hash cons'd into the key; two
+//	problems with the same key must yield the same sequence of unifiers,
+//	including the choice of fresh variable names. Only problems that were
+//	solved completely, without any theory flagging incompleteness, should
+//	have their entries completed since replaying a problem doesn't repeat
+//	any warnings that solving it gave.
+//
+#ifndef _unifierCache_hh_
+#define _unifierCache_hh_
+#include <map>
+#include "hashConsSet.hh"
+#include "simpleRootContainer.hh"
+
+class UnifierCache : private SimpleRootContainer
+{
+  NO_COPYING(UnifierCache);
+
+public:
+  //
+  //	Entry indices keep increasing across flushes so that a problem that
+  //	started recording before a flush can't write into an entry after it.
+  //
+  typedef Int64 Index;
+
+  UnifierCache();
+  ~UnifierCache();
+
+  Index getEntry(const Vector<DagNode*>& keyDags, Vector<int>& key);
+  bool isComplete(Index index) const;
+  int getNrUnifiers(Index index) const;
+  const Substitution& getUnifier(Index index, int unifierNr) const;
+  int getNrFreeVariables(Index index, int unifierNr) const;
+
+  void addUnifier(Index index, const Substitution& unifier, int nrFreeVariables);
+  void completeEntry(Index index);
+  void showStatistics(ostream& s) const;
+  void showStatisticsJson(ostream& s) const;
+  //
+  //	Bound on the number of problems plus unifiers a cache holds before
+  //	it is flushed; 0 disables caching.
+  //
+  static void setMaxSize(int size);
+  static bool isEnabled();
+
+private:
+  struct Entry
+  {
+    Vector<Substitution*> unifiers;
+    Vector<int> nrFreeVariables;
+    bool complete;
+  };
+
+  typedef map<Vector<int>, int> EntryMap;
+
+  void markReachableNodes();
+  void flush();
+  void discardUnifiers(Entry& entry);
+
+  static int maxSize;
+
+  HashConsSet dags;
+  EntryMap entryMap;
+  Vector<Entry> entries;
+  Index firstIndex;  // index of local entry 0 in current generation
+  int nrUnifiers;
+  Int64 nrHits;
+  Int64 nrMisses;
+  Int64 nrFlushes;
+};
+
+inline
+UnifierCache::UnifierCache()
+{
+  firstIndex = 0;
+  nrUnifiers = 0;
+  nrHits = 0;
+  nrMisses = 0;
+  nrFlushes = 0;
+}
+
+inline bool
+UnifierCache::isComplete(Index index) const
+{
+  return entries[index - firstIndex].complete;
+}
+
+inline int
+UnifierCache::getNrUnifiers(Index index) const
+{
+  return entries[index - firstIndex].unifiers.size();
+}
+
+inline const Substitution&
+UnifierCache::getUnifier(Index index, int unifierNr) const
+{
+  return *(entries[index - firstIndex].unifiers[unifierNr]);
+}
+
+inline int
+UnifierCache::getNrFreeVariables(Index index, int unifierNr) const
+{
+  return entries[index - firstIndex].nrFreeVariables[unifierNr];
+}
+
+inline void
+UnifierCache::completeEntry(Index index)
+{
+  //
+  //	An index from before the last flush has nothing to refer to.
+  //
+  if (index >= firstIndex)
+    entries[index - firstIndex].complete = true;
+}
+
+inline void
+UnifierCache::setMaxSize(int size)
+{
+  maxSize = size;
+}
+
+inline bool
+UnifierCache::isEnabled()
+{
+  return maxSize != 0;
+}
+
+#endif
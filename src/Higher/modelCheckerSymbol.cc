@@ -187,13 +187,12 @@ ModelCheckerSymbol::makeTransition(const StateTransitionGraph& states, int state
   static Vector<DagNode*> args(2);
 
   args[0] = states.getStateDag(stateNr);
-  const StateTransitionGraph::ArcMap& fwdArcs = states.getStateFwdArcs(stateNr);
-  StateTransitionGraph::ArcMap::const_iterator i = fwdArcs.find(targetNr);
-  if (i == fwdArcs.end())
+  Rule* rule = states.getArcRule(stateNr, targetNr);
+  if (rule == 0)
     args[1] = deadlockSymbol->makeDagNode();
   else
     {
-      int id = (*(i->second.begin()))->getLabel().id();
+      int id = rule->getLabel().id();
       args[1] = (id == NONE) ? unlabeledSymbol->makeDagNode() :
 	new QuotedIdentifierDagNode(qidSymbol, id);
     }
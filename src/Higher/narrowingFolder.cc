@@ -38,6 +38,11 @@
 #include "term.hh"
 #include "lhsAutomaton.hh"
 #include "subproblem.hh"
+#include "argumentIterator.hh"
+#include "dagArgumentIterator.hh"
+
+//	free theory class definitions
+#include "freeSymbol.hh"
 
 //	core class definitions
 #include "rewritingContext.hh"
@@ -93,17 +98,26 @@ NarrowingFolder::markReachableNodes()
 bool
 NarrowingFolder::insertState(int index, DagNode* state, int parentIndex)
 {
+  Vector<Symbol*> subjectKey;
   if (fold)
     {
       //
-      //	See if state is subsumed by an existing state.
+      //	See if state is subsumed by an existing state. Only those found
+      //	in the subsumer index can match it. We look at candidates in index
+      //	order so we report the same subsumer as a linear search would.
       //
-      for (auto& i : mostGeneralSoFar)
+      Vector<int> subtermEnds;
+      makeSubjectKey(state, subjectKey, subtermEnds);
+      Vector<int> candidates;
+      findPotentialSubsumers(subsumerIndex, 0, subjectKey, subtermEnds, candidates);
+      sort(candidates.begin(), candidates.end());
+      for (int c : candidates)
 	{
-	  if (i.second->subsumes(state))
+	  RetainedState* candidate = mostGeneralSoFar[c];
+	  if (candidate->subsumes(state))
 	    {
-	      DebugAdvisory("new state " << index << " subsumed by " << i.first);
-	      Verbose("New state " << state << " subsumed by " << i.second->state);
+	      DebugAdvisory("new state " << index << " subsumed by " << c);
+	      Verbose("New state " << state << " subsumed by " << candidate->state);
 	      return false;
 	    }
 	}
@@ -132,45 +146,61 @@ NarrowingFolder::insertState(int index, DagNode* state, int parentIndex)
 	  i = j->second->parentIndex;
 	}
       //
-      //	See if newState can evict an existing state.
+      //	See if newState can evict existing states. Only those found in the
+      //	victim index can be directly subsumed; we can't mess with ancestors
+      //	of the new state.
       //
-      StateSet existingStatesSubsumed;
-      RetainedStateMap::iterator i = mostGeneralSoFar.begin();
-      while (i != mostGeneralSoFar.end())
+      StateSet directlySubsumed;
+      Vector<int> potentialVictims;
+      findPotentialVictims(victimIndex, 0, newState->patternKey, potentialVictims);
+      for (int i : potentialVictims)
+	{
+	  if (ancestors.find(i) == ancestors.end() &&
+	      newState->subsumes(mostGeneralSoFar[i]->state))
+	    directlySubsumed.insert(i);
+	}
+      if (!(directlySubsumed.empty()))
 	{
-	  RetainedStateMap::iterator next = i;
-	  ++next;
-	  if (ancestors.find(i->first) == ancestors.end())  // can't mess with ancestors of new state
+	  //
+	  //	Evict the directly subsumed states together with their descendents.
+	  //	Since a state has a larger index than its parent, a single pass in
+	  //	index order suffices.
+	  //
+	  StateSet existingStatesSubsumed;
+	  RetainedStateMap::iterator i = mostGeneralSoFar.find(*(directlySubsumed.begin()));
+	  while (i != mostGeneralSoFar.end())
 	    {
-	      RetainedState* potentialVictim = i->second;
-	      if (existingStatesSubsumed.find(potentialVictim->parentIndex) !=
-		  existingStatesSubsumed.end())
+	      RetainedStateMap::iterator next = i;
+	      ++next;
+	      if (ancestors.find(i->first) == ancestors.end())
 		{
-		  //
-		  //	Our parent was subsumed so we are also subsumed.
-		  //
-		  DebugAdvisory("new state evicted descendent of an older state " << i->first);
-		  Verbose("New state " << state <<
-			  " evicted descendent of an older state " << i->second->state <<
-			  " by subsuming an ancestor.");
-		  existingStatesSubsumed.insert(i->first);
-		  delete potentialVictim;
-		  mostGeneralSoFar.erase(i);
-		}
-	      else if (newState->subsumes(potentialVictim->state))
-		{
-		  //
-		  //	Direct subsumption by new state.
-		  //
-		  DebugAdvisory("new state evicted an older state " << i->first);
-		  Verbose("New state " << state << " subsumed older state " <<
-			  i->second->state);
-		  existingStatesSubsumed.insert(i->first);
-		  delete potentialVictim;
-		  mostGeneralSoFar.erase(i);
+		  if (existingStatesSubsumed.find(i->second->parentIndex) !=
+		      existingStatesSubsumed.end())
+		    {
+		      //
+		      //	Our parent was subsumed so we are also subsumed.
+		      //
+		      DebugAdvisory("new state evicted descendent of an older state " << i->first);
+		      Verbose("New state " << state <<
+			      " evicted descendent of an older state " << i->second->state <<
+			      " by subsuming an ancestor.");
+		      existingStatesSubsumed.insert(i->first);
+		      evict(i);
+		    }
+		  else if (directlySubsumed.find(i->first) != directlySubsumed.end())
+		    {
+		      //
+		      //	Direct subsumption by new state.
+		      //
+		      DebugAdvisory("new state evicted an older state " << i->first);
+		      Verbose("New state " << state << " subsumed older state " <<
+			      i->second->state);
+		      existingStatesSubsumed.insert(i->first);
+		      evict(i);
+		    }
 		}
+	      i = next;
 	    }
-	  i = next;
 	}
     }
   else
@@ -185,9 +215,147 @@ NarrowingFolder::insertState(int index, DagNode* state, int parentIndex)
 	++(mostGeneralSoFar[parentIndex]->nrDescendants);
     }
   mostGeneralSoFar.insert(RetainedStateMap::value_type(index, newState));
+  if (fold)
+    {
+      newState->subjectKey.swap(subjectKey);
+      subsumerIndex.insert(newState->patternKey, 0, index);
+      victimIndex.insert(newState->subjectKey, 0, index);
+    }
   return true;
 }
 
+void
+NarrowingFolder::evict(RetainedStateMap::iterator victim)
+{
+  RetainedState* retainedState = victim->second;
+  (void) subsumerIndex.remove(retainedState->patternKey, 0, victim->first);
+  (void) victimIndex.remove(retainedState->subjectKey, 0, victim->first);
+  delete retainedState;
+  mostGeneralSoFar.erase(victim);
+}
+
+bool
+NarrowingFolder::argumentsInKey(Symbol* symbol)
+{
+  //
+  //	Only for free symbols do the arguments of a pattern line up with
+  //	those of the subjects it can match.
+  //
+  return dynamic_cast<FreeSymbol*>(symbol) != 0;
+}
+
+void
+NarrowingFolder::makePatternKey(Term* term, Vector<Symbol*>& key)
+{
+  if (!(term->stable()))
+    {
+      key.append(0);
+      return;
+    }
+  Symbol* symbol = term->symbol();
+  key.append(symbol);
+  if (argumentsInKey(symbol))
+    {
+      for (ArgumentIterator a(*term); a.valid(); a.next())
+	makePatternKey(a.argument(), key);
+    }
+}
+
+void
+NarrowingFolder::makeSubjectKey(DagNode* dagNode, Vector<Symbol*>& key, Vector<int>& subtermEnds)
+{
+  //
+  //	subtermEnds records, for each position in the key, the position just
+  //	after the subterm that starts there.
+  //
+  int start = key.size();
+  Symbol* symbol = dagNode->symbol();
+  key.append(symbol);
+  subtermEnds.append(NONE);
+  if (argumentsInKey(symbol))
+    {
+      for (DagArgumentIterator a(dagNode); a.valid(); a.next())
+	makeSubjectKey(a.argument(), key, subtermEnds);
+    }
+  subtermEnds[start] = key.size();
+}
+
+void
+NarrowingFolder::findPotentialSubsumers(const StateTrie& trie,
+					int position,
+					const Vector<Symbol*>& key,
+					const Vector<int>& subtermEnds,
+					Vector<int>& subsumers)
+{
+  if (position == key.length())
+    {
+      for (int i : trie.leaves)
+	subsumers.append(i);
+      return;
+    }
+  //
+  //	An unstable pattern subterm can match the whole subterm at this
+  //	position; otherwise the pattern must have the same symbol.
+  //
+  auto i = trie.children.find(0);
+  if (i != trie.children.end())
+    findPotentialSubsumers(*(i->second), subtermEnds[position], key, subtermEnds, subsumers);
+  i = trie.children.find(key[position]);
+  if (i != trie.children.end())
+    findPotentialSubsumers(*(i->second), position + 1, key, subtermEnds, subsumers);
+}
+
+void
+NarrowingFolder::findPotentialVictims(const StateTrie& trie,
+				      int position,
+				      const Vector<Symbol*>& key,
+				      Vector<int>& victims)
+{
+  if (position == key.length())
+    {
+      for (int i : trie.leaves)
+	victims.append(i);
+      return;
+    }
+  Symbol* symbol = key[position];
+  if (symbol == 0)
+    {
+      //
+      //	Unstable pattern subterm can match any subterm.
+      //
+      skipSubterms(trie, 1, position + 1, key, victims);
+    }
+  else
+    {
+      auto i = trie.children.find(symbol);
+      if (i != trie.children.end())
+	findPotentialVictims(*(i->second), position + 1, key, victims);
+    }
+}
+
+void
+NarrowingFolder::skipSubterms(const StateTrie& trie,
+			      int nrSubterms,
+			      int position,
+			      const Vector<Symbol*>& key,
+			      Vector<int>& victims)
+{
+  if (nrSubterms == 0)
+    {
+      findPotentialVictims(trie, position, key, victims);
+      return;
+    }
+  //
+  //	Each child starts a subterm whose arguments, if any, follow it.
+  //
+  for (const auto& i : trie.children)
+    {
+      Symbol* symbol = i.first;
+      int nrArgs = argumentsInKey(symbol) ? symbol->arity() : 0;
+      skipSubterms(*(i.second), nrSubterms - 1 + nrArgs, position, key, victims);
+    }
+}
+
 void
 NarrowingFolder::addHistory(int index,
 			    Rule* rule,
@@ -310,6 +478,7 @@ NarrowingFolder::RetainedState::RetainedState(DagNode* state, int parentIndex, b
 
       matchingAutomaton = t->compileLhs(false, variableInfo, boundUniquely, subproblemLikely);
       stateTerm = t;
+      makePatternKey(t, patternKey);
       nrMatchingVariables = variableInfo.getNrProtectedVariables();  // may also have some
       								     // abstraction variables
     }
@@ -363,3 +532,44 @@ NarrowingFolder::RetainedState::subsumes(DagNode* state) const
   delete subproblem;
   return result;
 }
+
+NarrowingFolder::StateTrie::~StateTrie()
+{
+  for (auto& i : children)
+    delete i.second;
+}
+
+void
+NarrowingFolder::StateTrie::insert(const Vector<Symbol*>& key, int position, int index)
+{
+  if (position == key.length())
+    {
+      leaves.insert(index);
+      return;
+    }
+  StateTrie*& child = children[key[position]];
+  if (child == 0)
+    child = new StateTrie;
+  child->insert(key, position + 1, index);
+}
+
+bool
+NarrowingFolder::StateTrie::remove(const Vector<Symbol*>& key, int position, int index)
+{
+  //
+  //	Returns true if this trie has become empty.
+  //
+  if (position == key.length())
+    leaves.erase(index);
+  else
+    {
+      auto i = children.find(key[position]);
+      Assert(i != children.end(), "missing key symbol");
+      if (i->second->remove(key, position + 1, index))
+	{
+	  delete i->second;
+	  children.erase(i);
+	}
+    }
+  return children.empty() && leaves.empty();
+}
@@ -97,6 +97,8 @@ private:
     //	Only used for folding.
     //
     Term* stateTerm;
+    Vector<Symbol*> patternKey;  // key of stateTerm in subsumerIndex
+    Vector<Symbol*> subjectKey;  // key of state in victimIndex
     LhsAutomaton* matchingAutomaton;
     int nrMatchingVariables;  // number of variables needed for matching; includes
     			      // any abstraction variables
@@ -116,13 +118,54 @@ private:
 
   typedef map<int, RetainedState*> RetainedStateMap;
   typedef set<int> StateSet;
+  //
+  //	When folding, retained states are indexed by discrimination tries.
+  //	A key lists the symbols of a term in preorder, where only the arguments
+  //	of free symbols are listed. In the subsumer index, keys come from state
+  //	terms and an unstable subterm is listed as 0 with its arguments omitted;
+  //	in the victim index, keys come from state dags. A state can only subsume
+  //	states on paths whose symbols agree with its key, other than at 0s.
+  //
+  struct StateTrie
+  {
+    NO_COPYING(StateTrie);
+
+    StateTrie() {}
+    ~StateTrie();
+    void insert(const Vector<Symbol*>& key, int position, int index);
+    bool remove(const Vector<Symbol*>& key, int position, int index);
+
+    map<Symbol*, StateTrie*> children;
+    StateSet leaves;  // states whose key ends here
+  };
 
   void markReachableNodes();
   void cleanGraph();
+  void evict(RetainedStateMap::iterator victim);
+
+  static bool argumentsInKey(Symbol* symbol);
+  static void makePatternKey(Term* term, Vector<Symbol*>& key);
+  static void makeSubjectKey(DagNode* dagNode, Vector<Symbol*>& key, Vector<int>& subtermEnds);
+  static void findPotentialSubsumers(const StateTrie& trie,
+				     int position,
+				     const Vector<Symbol*>& key,
+				     const Vector<int>& subtermEnds,
+				     Vector<int>& subsumers);
+  static void findPotentialVictims(const StateTrie& trie,
+				   int position,
+				   const Vector<Symbol*>& key,
+				   Vector<int>& victims);
+  static void skipSubterms(const StateTrie& trie,
+			   int nrSubterms,
+			   int position,
+			   const Vector<Symbol*>& key,
+			   Vector<int>& victims);
 
   const bool fold;  // we do folding to prune less general states
   const bool keepHistory;  // we keep the history of how we arrived at each state
   RetainedStateMap mostGeneralSoFar;
+  StateTrie subsumerIndex;
+  StateTrie victimIndex;
   int currentStateIndex;
 };
 
@@ -47,6 +47,7 @@
 #include "unificationContext.hh"
 #include "freshVariableGenerator.hh"
 #include "preEquation.hh"
+#include "unifierCache.hh"
 
 //	variable class definitions
 #include "variableDagNode.hh"
@@ -60,12 +61,14 @@ NarrowingUnificationProblem::NarrowingUnificationProblem(PreEquation* preEquatio
 							 DagNode* target,
 							 const NarrowingVariableInfo& variableInfo,
 							 FreshVariableGenerator* freshVariableGenerator,
-							 int variableFamily)
+							 int variableFamily,
+							 UnifierCache* unifierCache)
   : preEquation(preEquation),
     nrPreEquationVariables(preEquation->getNrRealVariables()),
     variableInfo(variableInfo),
     freshVariableGenerator(freshVariableGenerator),
-    variableFamily(variableFamily)
+    variableFamily(variableFamily),
+    unifierCache(unifierCache)
 {
   DebugAdvisory(Tty(Tty::MAGENTA) << "==== NarrowingUnificationProblem ====" << Tty(Tty::RESET));
   DebugAdvisory("preEquation->getLhsDag() = " << preEquation->getLhsDag());
@@ -97,6 +100,12 @@ NarrowingUnificationProblem::NarrowingUnificationProblem(PreEquation* preEquatio
       unsortedSolution->bind(i, 0);
     }
   //
+  //	If we have already solved this problem, we replay its unifiers.
+  //
+  viable = true;
+  if (findCachedUnifiers(preEquation->getIndexWithinModule(), target, 0))
+    return;
+  //
   //	Solve the underlying many-sorted unification problem.
   //
   viable = preEquation->getLhsDag()->computeSolvedForm(target, *unsortedSolution, pendingStack);
@@ -106,12 +115,14 @@ NarrowingUnificationProblem::NarrowingUnificationProblem(DagNode* lhs,
 							 DagNode* rhs,
 							 const NarrowingVariableInfo& variableInfo,
 							 FreshVariableGenerator* freshVariableGenerator,
-							 int variableFamily)
+							 int variableFamily,
+							 UnifierCache* unifierCache)
   : preEquation(0),
     nrPreEquationVariables(0),
     variableInfo(variableInfo),
     freshVariableGenerator(freshVariableGenerator),
-    variableFamily(variableFamily)
+    variableFamily(variableFamily),
+    unifierCache(unifierCache)
 {
   DebugAdvisory(Tty(Tty::GREEN) << "==== NarrowingUnificationProblem ====" << Tty(Tty::RESET));
   DebugAdvisory("lhs = " << lhs);
@@ -142,6 +153,12 @@ NarrowingUnificationProblem::NarrowingUnificationProblem(DagNode* lhs,
       unsortedSolution->bind(i, 0);  // HACK
     }
   //
+  //	If we have already solved this problem, we replay its unifiers.
+  //
+  viable = true;
+  if (findCachedUnifiers(NONE, lhs, rhs))
+    return;
+  //
   //	Solve the underlying many-sorted unification problem.
   //
   viable = lhs->computeSolvedForm(rhs, *unsortedSolution, pendingStack);
@@ -149,6 +166,8 @@ NarrowingUnificationProblem::NarrowingUnificationProblem(DagNode* lhs,
 
 NarrowingUnificationProblem::~NarrowingUnificationProblem()
 {
+  for (Substitution* s : cachedUnifiers)
+    delete s;
   delete orderSortedUnifiers;
   delete unsortedSolution;
   delete sortedSolution;
@@ -166,10 +185,105 @@ NarrowingUnificationProblem::markReachableNodes()
 	  d->mark();
       }
   }
+  for (Substitution* s : cachedUnifiers)
+    {
+      int nrFragile = s->nrFragileBindings();
+      for (int i = 0; i < nrFragile; i++)
+	{
+	  DagNode* d = s->value(i);
+	  if (d != 0)
+	    d->mark();
+	}
+    }
+}
+
+bool
+NarrowingUnificationProblem::findCachedUnifiers(int problemIndex, DagNode* target, DagNode* other)
+{
+  cacheIndex = NONE;
+  replaying = false;
+  if (unifierCache == 0)
+    return false;
+  //
+  //	The unifiers we generate are determined by the rule or equation (or NONE for
+  //	an lhs =? rhs problem), the dags being unified, the variables in variableInfo
+  //	since they determine the slots of target variables, and the names that our
+  //	generator will give fresh variables in our family; since fresh variables are
+  //	numbered consecutively we record the name of the first one.
+  //
+  //	We don't try to identify problems that are equal modulo renaming because
+  //	the renamed problem would generate its fresh variables and AC argument
+  //	orders differently, and we must produce exactly the same unifiers in the
+  //	same order as if we had solved the problem.
+  //
+  Vector<int> key(3);
+  key[0] = problemIndex;
+  key[1] = variableFamily;
+  key[2] = freshVariableGenerator->getFreshVariableName(0, variableFamily);
+  Vector<DagNode*> keyDags;
+  keyDags.append(target);
+  if (other != 0)
+    keyDags.append(other);
+  int nrVariables = variableInfo.getNrVariables();
+  for (int i = 0; i < nrVariables; ++i)
+    keyDags.append(variableInfo.index2Variable(i));
+
+  cacheIndex = unifierCache->getEntry(keyDags, key);
+  if (!(unifierCache->isComplete(cacheIndex)))
+    return false;  // we will record our unifiers as we generate them
+  //
+  //	We take our own copies of the unifiers since the cache could be
+  //	flushed while we are still in use.
+  //
+  int nrUnifiers = unifierCache->getNrUnifiers(cacheIndex);
+  cachedUnifiers.resize(nrUnifiers);
+  cachedNrFreeVariables.resize(nrUnifiers);
+  for (int i = 0; i < nrUnifiers; ++i)
+    {
+      const Substitution& unifier = unifierCache->getUnifier(cacheIndex, i);
+      cachedUnifiers[i] = new Substitution(unifier.nrFragileBindings());
+      cachedUnifiers[i]->clone(unifier);
+      cachedNrFreeVariables[i] = unifierCache->getNrFreeVariables(cacheIndex, i);
+    }
+  nextCachedUnifier = 0;
+  cacheIndex = NONE;
+  replaying = true;
+  return true;
 }
 
 bool
 NarrowingUnificationProblem::findNextUnifier()
+{
+  if (replaying)
+    {
+      if (nextCachedUnifier == cachedUnifiers.length())
+	return false;
+      sortedSolution->clone(*(cachedUnifiers[nextCachedUnifier]));
+      ++nextCachedUnifier;
+      return true;
+    }
+  if (computeNextUnifier())
+    {
+      if (cacheIndex != NONE)
+	unifierCache->addUnifier(cacheIndex, *sortedSolution, freeVariables.size());
+      return true;
+    }
+  if (cacheIndex != NONE)
+    {
+      //
+      //	We have seen every unifier so the cache entry is complete unless
+      //	some theory flagged incompleteness; replaying such a problem
+      //	wouldn't repeat its warnings so we leave it to be solved again.
+      //
+      if (!pendingStack.isIncomplete())
+	unifierCache->completeEntry(cacheIndex);
+      cacheIndex = NONE;
+    }
+  return false;
+}
+
+bool
+NarrowingUnificationProblem::computeNextUnifier()
 {
   if (!viable)
     return false;
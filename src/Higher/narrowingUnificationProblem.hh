@@ -40,6 +40,8 @@
 //	the cost of more copying if an unsorted unifier corresponds to multiple order-sorted unifiers.
 //	(7) Narrowing unification supports the idea of variables families to avoid clashing variable
 //	names on successive steps of narrowing.
+//	(8) Narrowing unification can look up and record complete unifier sets in a UnifierCache
+//	so that a problem that recurs exactly during variant narrowing is only solved once.
 //
 #ifndef _narrowingUnificationProblem_hh_
 #define _narrowingUnificationProblem_hh_
@@ -60,7 +62,8 @@ public:
 			      DagNode* target,
 			      const NarrowingVariableInfo& variableInfo,
 			      FreshVariableGenerator* freshVariableGenerator,
-			      int variableFamily = 0);
+			      int variableFamily = 0,
+			      UnifierCache* unifierCache = 0);
   //
   //	However for variant unification, we also need to unify a pair of DagNode* arguments.
   //
@@ -68,7 +71,8 @@ public:
 			      DagNode* rhs,
 			      const NarrowingVariableInfo& variableInfo,
 			      FreshVariableGenerator* freshVariableGenerator,
-			      int variableFamily);
+			      int variableFamily,
+			      UnifierCache* unifierCache = 0);
 
   ~NarrowingUnificationProblem();
 
@@ -79,6 +83,8 @@ public:
 
 private:
   void markReachableNodes();
+  bool findCachedUnifiers(int problemIndex, DagNode* target, DagNode* other);
+  bool computeNextUnifier();
   Sort* variableIndexToSort(int index);
   void bindFreeVariables();
   bool findOrderSortedUnifiers();
@@ -101,6 +107,15 @@ private:
   NatSet sortConstrainedVariables;	// subset of the above whose sorts are constrained by their appearence in bindings of other variables
   AllSat* orderSortedUnifiers;		// satisfiability problem encoding sorts for order-sorted unifiers
   Substitution* sortedSolution;		// for construction order-sorted unifiers
+  //
+  //	Unifier caching.
+  //
+  UnifierCache* const unifierCache;
+  Int64 cacheIndex;			// entry we are recording unifiers in or NONE
+  bool replaying;			// true if unifiers are coming from the cache
+  Vector<Substitution*> cachedUnifiers;	// our own copies of cached unifiers
+  Vector<int> cachedNrFreeVariables;
+  int nextCachedUnifier;
 };
 
 inline Substitution&
@@ -112,14 +127,14 @@ NarrowingUnificationProblem::getSolution() const
 inline int
 NarrowingUnificationProblem::getNrFreeVariables() const
 {
-  return freeVariables.size();
+  return replaying ? cachedNrFreeVariables[nextCachedUnifier - 1] : freeVariables.size();
 }
 
 inline bool
 NarrowingUnificationProblem::isIncomplete() const
 {
   //cout << "NarrowingUnificationProblem::isIncomplete() returned " << pendingStack.isIncomplete() << endl;
-  return pendingStack.isIncomplete();
+  return !replaying && pendingStack.isIncomplete();  // we only cache complete problems
 }
 
 #endif
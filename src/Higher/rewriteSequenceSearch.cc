@@ -187,6 +187,5 @@ RewriteSequenceSearch::findNextInterestingState()
 Rule*
 RewriteSequenceSearch::getStateRule(int stateNr) const
 {
-  const ArcMap& fwdArcs = getStateFwdArcs(getStateParent(stateNr));
-  return *(fwdArcs.find(stateNr)->second.begin());
+  return getArcRule(getStateParent(stateNr), stateNr);
 }
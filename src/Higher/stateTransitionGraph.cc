@@ -45,12 +45,7 @@ StateTransitionGraph::StateTransitionGraph(RewritingContext* initial)
   : initial(initial)
 {
   initial->reduce();
-  int hashConsIndex = hashConsSet.insert(initial->root());
-  hashCons2seen.resize(hashConsIndex + 1);
-  for (int i = 0; i < hashConsIndex; ++i)
-    hashCons2seen[i] = NONE;
-  hashCons2seen[hashConsIndex] = seen.size();
-  seen.append(new State(hashConsIndex, NONE));
+  (void) insertNewState(initial->root(), NONE);
 }
 
 StateTransitionGraph::~StateTransitionGraph()
@@ -68,9 +63,9 @@ int
 StateTransitionGraph::getNextState(int stateNr, int index)
 {
   State* n = seen[stateNr];
-  int nrNextStates = n->nextStates.length();
+  int nrNextStates = n->arcs.length();
   if (index < nrNextStates)
-    return n->nextStates[index];
+    return n->arcs[index].nextState;
   if (n->fullyExplored)
     return NONE;
   if (n->rewriteState == 0)
@@ -125,43 +120,8 @@ StateTransitionGraph::getNextState(int stateNr, int index)
 	  initial->addInCount(*c);
 	  delete c;
 
-	  int nextState;
-	  int hashConsIndex = hashConsSet.insert(r.first);
-	  int mapSize = hashCons2seen.size();
-	  //DebugAdvisory("replacement dag = " << r.first << "hashConsIndex = " << hashConsIndex);
-	  if (hashConsIndex >= mapSize)
-	    {
-	      //
-	      //	Definitely a new state.
-	      //
-	      hashCons2seen.resize(hashConsIndex + 1);
-	      for (int i = mapSize; i < hashConsIndex; ++i)
-		hashCons2seen[i] = NONE;
-	      nextState = seen.size();
-	      hashCons2seen[hashConsIndex] = nextState;
-	      seen.append(new State(hashConsIndex, stateNr));
-	      DebugAdvisory("new state dag = " << r.first <<
-			    " hashConsIndex = " << hashConsIndex <<
-			    " collisionCounter = " << hashConsSet.collisionCounter);
-	    }
-	  else
-	    {
-	      //
-	      //	Seen before.
-	      //
-	      nextState = hashCons2seen[hashConsIndex];
-	      if (nextState == NONE)
-		{
-		  //
-		  //	 But only as a subdag, not as a state dag, so it counts as a new state.
-		  //
-		  nextState = seen.size();
-		  hashCons2seen[hashConsIndex] = nextState;
-		  seen.append(new State(hashConsIndex, stateNr));
-		}
-	    }
-	  n->nextStates.append(nextState);
-	  n->fwdArcs[nextState].insert(rule);
+	  int nextState = insertNewState(r.first, stateNr);
+	  n->arcs.append({nextState, rule});
 	  ++nrNextStates;
 	  //
 	  //	If we didn't do any equational rewriting we will not have had a chance to
@@ -177,5 +137,73 @@ StateTransitionGraph::getNextState(int stateNr, int index)
 	  return NONE;
 	}
     }
-  return n->nextStates[index];
+  return n->arcs[index].nextState;
+}
+
+void
+StateTransitionGraph::getSortedArcs(int stateNr, Vector<Arc>& sortedArcs) const
+{
+  //
+  //	Arcs ordered by next state and then rule, without repeats, for display.
+  //
+  sortedArcs = seen[stateNr]->arcs;
+  sort(sortedArcs.begin(), sortedArcs.end());
+  sortedArcs.contractTo(unique(sortedArcs.begin(), sortedArcs.end()) - sortedArcs.begin());
+}
+
+Rule*
+StateTransitionGraph::getArcRule(int stateNr, int nextStateNr) const
+{
+  //
+  //	If several rules produce the same arc we return the one that sorts
+  //	first, to agree with getSortedArcs(). Returns 0 if there is no such arc.
+  //
+  Rule* rule = 0;
+  for (const Arc& a : seen[stateNr]->arcs)
+    {
+      if (a.nextState == nextStateNr && (rule == 0 || a.rule < rule))
+	rule = a.rule;
+    }
+  return rule;
+}
+
+int
+StateTransitionGraph::insertNewState(DagNode* stateDag, int parent)
+{
+  //
+  //	This is the only place where state numbers are assigned. The number a state
+  //	gets depends only on the order in which successor dags are presented here and
+  //	not on how they were generated, so any scheme for generating successors ahead
+  //	of time must still present them in arc order to preserve state numbering.
+  //
+  int hashConsIndex = hashConsSet.insert(stateDag);
+  int mapSize = hashCons2seen.size();
+  if (hashConsIndex >= mapSize)
+    {
+      //
+      //	Definitely a new state.
+      //
+      hashCons2seen.resize(hashConsIndex + 1);
+      for (int i = mapSize; i < hashConsIndex; ++i)
+	hashCons2seen[i] = NONE;
+      DebugAdvisory("new state dag = " << stateDag <<
+		    " hashConsIndex = " << hashConsIndex <<
+		    " collisionCounter = " << hashConsSet.collisionCounter);
+    }
+  else
+    {
+      //
+      //	Seen before.
+      //
+      int stateNr = hashCons2seen[hashConsIndex];
+      if (stateNr != NONE)
+	return stateNr;
+      //
+      //	But only as a subdag, not as a state dag, so it counts as a new state.
+      //
+    }
+  int stateNr = seen.size();
+  hashCons2seen[hashConsIndex] = stateNr;
+  seen.append(new State(hashConsIndex, parent));
+  return stateNr;
 }
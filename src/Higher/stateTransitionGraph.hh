@@ -35,7 +35,20 @@ class StateTransitionGraph
   NO_COPYING(StateTransitionGraph);
 
 public:
-  typedef map<int, set<Rule*> > ArcMap;
+  //
+  //	We record each arc together with the rule that produced it rather
+  //	than keeping a map from next states to rules per state, since map
+  //	and vector overheads would dominate the memory used by large state
+  //	spaces.
+  //
+  struct Arc
+  {
+    bool operator<(const Arc& other) const;
+    bool operator==(const Arc& other) const;
+
+    int nextState;
+    Rule* rule;
+  };
 
   StateTransitionGraph(RewritingContext* initial);
   ~StateTransitionGraph();
@@ -43,7 +56,8 @@ public:
   int getNrStates() const;
   int getNextState(int stateNr, int index);
   DagNode* getStateDag(int stateNr) const;
-  const ArcMap& getStateFwdArcs(int stateNr) const;
+  void getSortedArcs(int stateNr, Vector<Arc>& sortedArcs) const;
+  Rule* getArcRule(int stateNr, int nextStateNr) const;
   //
   //	Stuff needed for search.
   //
@@ -58,13 +72,12 @@ private:
 
     const int hashConsIndex;
     const int parent;
-    Vector<int> nextStates;
+    Vector<Arc> arcs;  // in the order they were found
     RewriteSearchState* rewriteState;
     bool fullyExplored;
-    ArcMap fwdArcs;
   };
 
-  void insertNewState(int parent);
+  int insertNewState(DagNode* stateDag, int parent);
 
   RewritingContext* initial;
   Vector<State*> seen;
@@ -72,6 +85,18 @@ private:
   HashConsSet hashConsSet;
 };
 
+inline bool
+StateTransitionGraph::Arc::operator<(const Arc& other) const
+{
+  return nextState < other.nextState || (nextState == other.nextState && rule < other.rule);
+}
+
+inline bool
+StateTransitionGraph::Arc::operator==(const Arc& other) const
+{
+  return nextState == other.nextState && rule == other.rule;
+}
+
 inline
 StateTransitionGraph::State::State(int hashConsIndex, int parent)
   : hashConsIndex(hashConsIndex),
@@ -93,12 +118,6 @@ StateTransitionGraph::getStateDag(int stateNr) const
   return hashConsSet.getCanonical(seen[stateNr]->hashConsIndex);
 }
 
-inline const StateTransitionGraph::ArcMap&
-StateTransitionGraph::getStateFwdArcs(int stateNr) const
-{
-  return seen[stateNr]->fwdArcs;
-}
-
 inline RewritingContext*
 StateTransitionGraph::getContext()
 {
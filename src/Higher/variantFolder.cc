@@ -69,15 +69,125 @@ VariantFolder::markReachableNodes()
     }
 }
 
+void
+VariantFolder::patternKey(const RetainedVariant* retainedVariant, Vector<Symbol*>& key) const
+{
+  int nrDags = retainedVariant->topSymbols.size();
+  int lastDagToCheck = ignoreSubstitution ?  nrDags - 1 : 0;
+  for (int i = nrDags - 1; i >= lastDagToCheck; --i)
+    key.append(retainedVariant->topSymbols[i]);
+}
+
+void
+VariantFolder::subjectKey(const Vector<DagNode*>& variant, Vector<Symbol*>& key) const
+{
+  int nrDags = variant.size();
+  int lastDagToCheck = ignoreSubstitution ?  nrDags - 1 : 0;
+  for (int i = nrDags - 1; i >= lastDagToCheck; --i)
+    key.append(variant[i]->symbol());
+}
+
 bool
 VariantFolder::isSubsumed(const Vector<DagNode*>& variant) const
 {
-  for (auto& i : mostGeneralSoFar)
+  return findSubsumer(variant) != 0;
+}
+
+const VariantFolder::RetainedVariant*
+VariantFolder::findSubsumer(const Vector<DagNode*>& variant) const
+{
+  TrieIndex::const_iterator i = subsumerIndex.find(variant.size());
+  if (i == subsumerIndex.end())
+    return 0;
+  Vector<Symbol*> key;
+  subjectKey(variant, key);
+  //
+  //	Only variants found in the subsumer index can subsume variant. We look
+  //	at candidates in index order so we report the same subsumer as a linear
+  //	search would.
+  //
+  Vector<int> candidates;
+  findPotentialSubsumers(i->second, 0, key, candidates);
+  sort(candidates.begin(), candidates.end());
+  for (int c : candidates)
     {
-      if (subsumes(i.second, variant))
-	return true;  
+      const RetainedVariant* candidate = mostGeneralSoFar.find(c)->second;
+      if (subsumes(candidate, variant))
+	return candidate;
     }
-  return false;
+  return 0;
+}
+
+void
+VariantFolder::findPotentialSubsumers(const TopSymbolTrie& trie,
+				      int level,
+				      const Vector<Symbol*>& key,
+				      Vector<int>& subsumers)
+{
+  if (level == key.length())
+    {
+      for (const auto& i : trie.leaves)
+	subsumers.append(i.first);
+      return;
+    }
+  //
+  //	Patterns with an unstable term at this position, and patterns whose
+  //	top symbol agrees with that of the subject.
+  //
+  auto i = trie.children.find(0);
+  if (i != trie.children.end())
+    findPotentialSubsumers(*(i->second), level + 1, key, subsumers);
+  i = trie.children.find(key[level]);
+  if (i != trie.children.end())
+    findPotentialSubsumers(*(i->second), level + 1, key, subsumers);
+}
+
+void
+VariantFolder::findPotentialVictims(const TopSymbolTrie& trie,
+				    int level,
+				    const Vector<Symbol*>& key,
+				    Vector<int>& victims)
+{
+  if (level == key.length())
+    {
+      for (const auto& i : trie.leaves)
+	victims.append(i.first);
+      return;
+    }
+  Symbol* s = key[level];
+  if (s == 0)
+    {
+      //
+      //	Unstable pattern term can match anything.
+      //
+      for (const auto& i : trie.children)
+	findPotentialVictims(*(i.second), level + 1, key, victims);
+    }
+  else
+    {
+      auto i = trie.children.find(s);
+      if (i != trie.children.end())
+	findPotentialVictims(*(i->second), level + 1, key, victims);
+    }
+}
+
+void
+VariantFolder::evict(RetainedVariantMap::iterator victim)
+{
+  RetainedVariant* retainedVariant = victim->second;
+  int nrDags = retainedVariant->variant.size();
+  Vector<Symbol*> key;
+  patternKey(retainedVariant, key);
+  TrieIndex::iterator i = subsumerIndex.find(nrDags);
+  if (i->second.remove(key, 0, victim->first))
+    subsumerIndex.erase(i);
+  key.clear();
+  subjectKey(retainedVariant->variant, key);
+  i = victimIndex.find(nrDags);
+  if (i->second.remove(key, 0, victim->first))
+    victimIndex.erase(i);
+  delete retainedVariant;
+  mostGeneralSoFar.erase(victim);
 }
 
 bool
@@ -90,10 +200,11 @@ VariantFolder::insertVariant(const Vector<DagNode*>& variant,
   //
   //	First we check if it is subsumed by one of the existing variants.
   //
-  if (isSubsumed(variant))
+  if (const RetainedVariant* subsumer = findSubsumer(variant))
     {
       //DebugAlways("new variant subsumed=" << variant.back());
       DebugAdvisory("new variant subsumed");
+      Verbose("New variant " << variant.back() << " subsumed by " << subsumer->variant.back());
       return false;
     }
   //DebugAlways("new variant added=" << variant.back());
@@ -114,42 +225,64 @@ VariantFolder::insertVariant(const Vector<DagNode*>& variant,
       i = j->second->parentIndex;
     }
   //
-  //	See if this variant can evict an existing variant.
+  //	See if this variant can evict existing variants. Only those found in the
+  //	victim index can be directly subsumed; we can't mess with ancestors of
+  //	the new variant.
   //
   set<int> existingVariantsSubsumed;
-  RetainedVariantMap::iterator i = mostGeneralSoFar.begin();
-  while (i != mostGeneralSoFar.end())
+  TrieIndex::const_iterator candidates = victimIndex.find(variant.size());
+  if (candidates != victimIndex.end())
     {
-      RetainedVariantMap::iterator next = i;
-      ++next;
-
-      if (ancestors.find(i->first) == ancestors.end())  // can't mess with ancestors of new variant
+      Vector<Symbol*> key;
+      patternKey(newVariant, key);
+      Vector<int> potentialVictims;
+      findPotentialVictims(candidates->second, 0, key, potentialVictims);
+      for (int i : potentialVictims)
 	{
-	  RetainedVariant* potentialVictim = i->second;
-	  if (existingVariantsSubsumed.find(potentialVictim->parentIndex) !=
-	      existingVariantsSubsumed.end())
+	  if (ancestors.find(i) == ancestors.end() &&
+	      subsumes(newVariant, mostGeneralSoFar[i]->variant))
 	    {
-	      //
-	      //	Our parent was subsumed so we are also subsumed.
-	      //
-	      //DebugAlways("new variant evicted descendent of an older variant " << i->first);
-	      existingVariantsSubsumed.insert(i->first);
-	      delete potentialVictim;
-	      mostGeneralSoFar.erase(i);
+	      //DebugAlways("new variant evicted an older variant " << i);
+	      existingVariantsSubsumed.insert(i);
+	    }
+	}
+    }
+  if (!(existingVariantsSubsumed.empty()))
+    {
+      //
+      //	Evict the directly subsumed variants together with their descendents.
+      //	Since a variant has a larger index than its parent, a single pass in
+      //	index order suffices.
+      //
+      RetainedVariantMap::iterator i = mostGeneralSoFar.find(*(existingVariantsSubsumed.begin()));
+      while (i != mostGeneralSoFar.end())
+	{
+	  RetainedVariantMap::iterator next = i;
+	  ++next;
+
+	  if (existingVariantsSubsumed.find(i->first) != existingVariantsSubsumed.end())
+	    {
+	      Verbose("New variant " << variant.back() << " subsumed older variant " <<
+		      i->second->variant.back());
+	      evict(i);
 	    }
-	  else if (subsumes(newVariant, potentialVictim->variant))
+	  else if (ancestors.find(i->first) == ancestors.end() &&
+		   existingVariantsSubsumed.find(i->second->parentIndex) !=
+		   existingVariantsSubsumed.end())
 	    {
 	      //
-	      //	Direct subsumption by new variant.
+	      //	Our parent was subsumed so we are also subsumed.
 	      //
-	      //DebugAlways("new variant evicted an older variant " << i->first);
+	      //DebugAlways("new variant evicted descendent of an older variant " << i->first);
+	      Verbose("New variant " << variant.back() <<
+		      " evicted descendent of an older variant " << i->second->variant.back() <<
+		      " by subsuming an ancestor.");
 	      existingVariantsSubsumed.insert(i->first);
-	      delete potentialVictim;
-	      mostGeneralSoFar.erase(i);
+	      evict(i);
 	    }
-	}
 
-      i = next;
+	  i = next;
+	}
     }
   //
   //	Add to the mostGeneralSoFar collection of variants.
@@ -166,6 +299,12 @@ VariantFolder::insertVariant(const Vector<DagNode*>& variant,
     }
 
   mostGeneralSoFar.insert(RetainedVariantMap::value_type(index, newVariant));
+  Vector<Symbol*> key;
+  patternKey(newVariant, key);
+  subsumerIndex[variant.size()].insert(key, 0, index, newVariant);
+  key.clear();
+  subjectKey(variant, key);
+  victimIndex[variant.size()].insert(key, 0, index, newVariant);
   return true;
 }
 
@@ -334,7 +473,8 @@ VariantFolder::findNextVariantThatMatches(int& indexOfLastUsedVariant,
 VariantFolder::RetainedVariant::RetainedVariant(const Vector<DagNode*> original)
   : variant(original),
     terms(original.size()),
-    matchingAutomata(original.size())
+    matchingAutomata(original.size()),
+    topSymbols(original.size())
 {
   int nrDags = original.size();
   for (int i = 0; i < nrDags; ++i)
@@ -346,6 +486,7 @@ VariantFolder::RetainedVariant::RetainedVariant(const Vector<DagNode*> original)
       t->symbol()->fillInSortInfo(t);
       t->analyseCollapses();
       terms[i] = t;
+      topSymbols[i] = t->stable() ? t->symbol() : 0;
     }
 
   nrFreeVariables = variableInfo.getNrRealVariables();
@@ -423,3 +564,47 @@ VariantFolder::RetainedVariant::dump()
       cerr << terms[i] << endl;
     }
 }
+
+VariantFolder::TopSymbolTrie::~TopSymbolTrie()
+{
+  for (auto& i : children)
+    delete i.second;
+}
+
+void
+VariantFolder::TopSymbolTrie::insert(const Vector<Symbol*>& key,
+				     int level,
+				     int index,
+				     RetainedVariant* retainedVariant)
+{
+  if (level == key.length())
+    {
+      leaves.insert(RetainedVariantMap::value_type(index, retainedVariant));
+      return;
+    }
+  TopSymbolTrie*& child = children[key[level]];
+  if (child == 0)
+    child = new TopSymbolTrie;
+  child->insert(key, level + 1, index, retainedVariant);
+}
+
+bool
+VariantFolder::TopSymbolTrie::remove(const Vector<Symbol*>& key, int level, int index)
+{
+  //
+  //	Returns true if this trie has become empty.
+  //
+  if (level == key.length())
+    leaves.erase(index);
+  else
+    {
+      auto i = children.find(key[level]);
+      Assert(i != children.end(), "missing key symbol");
+      if (i->second->remove(key, level + 1, index))
+	{
+	  delete i->second;
+	  children.erase(i);
+	}
+    }
+  return children.empty() && leaves.empty();
+}
@@ -121,17 +121,55 @@ private:
     Vector<DagNode*> variant;
     Vector<Term*> terms;
     Vector<LhsAutomaton*> matchingAutomata;
+    Vector<Symbol*> topSymbols;  // top symbol of each stable term, 0 if unstable
     int layerNumber;
   };
 
   typedef map<int, RetainedVariant*> RetainedVariantMap;
+  //
+  //	Retained variants are indexed by tries on the top symbols of the dags
+  //	that are compared for subsumption, taken in matching order. Different
+  //	sized variants are incomparable so each size has its own trie.
+  //	In the subsumer index a key holds the top symbol of each stable pattern
+  //	term and 0 for an unstable one; a variant can only be subsumed by retained
+  //	variants on paths that follow its own top symbols or 0. In the victim index
+  //	a key holds the actual top symbols; a new variant can only subsume retained
+  //	variants on paths that follow its stable top symbols.
+  //
+  struct TopSymbolTrie
+  {
+    NO_COPYING(TopSymbolTrie);
+
+    TopSymbolTrie() {}
+    ~TopSymbolTrie();
+    void insert(const Vector<Symbol*>& key, int level, int index, RetainedVariant* retainedVariant);
+    bool remove(const Vector<Symbol*>& key, int level, int index);
+
+    map<Symbol*, TopSymbolTrie*> children;
+    RetainedVariantMap leaves;  // variants whose key ends here
+  };
+  typedef map<int, TopSymbolTrie> TrieIndex;
 
   void markReachableNodes();
   bool subsumes(const RetainedVariant* retainedVariant,
 		const Vector<DagNode*>& variant) const;
+  void patternKey(const RetainedVariant* retainedVariant, Vector<Symbol*>& key) const;
+  void subjectKey(const Vector<DagNode*>& variant, Vector<Symbol*>& key) const;
+  const RetainedVariant* findSubsumer(const Vector<DagNode*>& variant) const;
+  static void findPotentialSubsumers(const TopSymbolTrie& trie,
+				     int level,
+				     const Vector<Symbol*>& key,
+				     Vector<int>& subsumers);
+  static void findPotentialVictims(const TopSymbolTrie& trie,
+				   int level,
+				   const Vector<Symbol*>& key,
+				   Vector<int>& victims);
+  void evict(RetainedVariantMap::iterator victim);
 
   const bool ignoreSubstitution;
   RetainedVariantMap mostGeneralSoFar;
+  TrieIndex subsumerIndex;
+  TrieIndex victimIndex;
   RetainedVariantMap::const_iterator currentVariant;
   int currentVariantIndex;
 };
@@ -111,6 +111,11 @@ VariantNarrowingSearchState::VariantNarrowingSearchState(RewritingContext* conte
   //
   unifiers = new UnifierFilter(firstTargetSlot, nrInterestingVariables);
   //
+  //	The same unification problems tend to recur as we explore the variant
+  //	narrowing tree so our module may be able to give us cached unifiers.
+  //
+  UnifierCache* unifierCache = module->getUnifierCache();
+  //
   //	Generate all unifiers between non-variable subterms in our variant term and variant
   //	equations in our module and insert them in our unifier filter.
   //
@@ -133,7 +138,8 @@ VariantNarrowingSearchState::VariantNarrowingSearchState(RewritingContext* conte
 					a.argument(),
 					variableInfo,
 					freshVariableGenerator,
-					variableFamily);
+					variableFamily,
+					unifierCache);
       collectUnifiers(unificationProblem, 0, NONE);
       incompleteFlag |= unificationProblem->isIncomplete();
       delete unificationProblem;
@@ -168,7 +174,8 @@ VariantNarrowingSearchState::VariantNarrowingSearchState(RewritingContext* conte
 						    d,
 						    variableInfo,
 						    freshVariableGenerator,
-						    variableFamily);
+						    variableFamily,
+						    unifierCache);
 		  collectUnifiers(unificationProblem, positionIndex, eq->getIndexWithinModule());
 		  incompleteFlag |= unificationProblem->isIncomplete();
 		  delete unificationProblem;
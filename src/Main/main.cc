@@ -44,6 +44,7 @@
 #include "objectSystem.hh"
 #include "strategyLanguage.hh"
 #include "mixfix.hh"
+#include "meta.hh"
  
 //      interface class definitions
 #include "term.hh"
@@ -51,6 +52,8 @@
 //      core class definitions
 #include "lineNumber.hh"
 #include "memoryCell.hh"
+#include "memoMap.hh"
+#include "unifierCache.hh"
 
 //      built class definitions
 #include "randomOpSymbol.hh"
@@ -69,9 +72,14 @@
 #include "fileTable.hh"
 #include "directoryManager.hh"
 #include "mixfixModule.hh"
+#include "visibleModule.hh"
+#include "profileModule.hh"
 #include "interpreter.hh"
 #include "global.hh"
 
+//      meta class definitions
+#include "interpreterManagerSymbol.hh"
+
 int
 main(int argc, char* argv[])
 {
@@ -120,6 +128,63 @@ main(int argc, char* argv[])
 			       ": bad associative unification depth value: " << QUOTE(s));
 		}
 	    }
+	  else if (const char* s = isFlag(arg, "-gc-slop="))
+	    {
+	      char *endptr;
+	      double m = strtod(s, &endptr);
+	      if (endptr > s && isfinite(m) && m >= 1.0 && m <= 1e3)
+		MemoryCell::setMinimumSlopFactor(m);
+	      else
+		{
+		  IssueWarning(LineNumber(FileTable::COMMAND_LINE) <<
+			       ": bad garbage collection slop value: " << QUOTE(s));
+		}
+	    }
+	  else if (const char* s = isFlag(arg, "-memo-limit="))
+	    {
+	      char *endptr;
+	      long m = strtol(s, &endptr, 10);
+	      if (endptr > s && *endptr == '\0' && m > 0 && m <= INT_MAX)
+		MemoMap::setMaxSize(m);
+	      else
+		{
+		  IssueWarning(LineNumber(FileTable::COMMAND_LINE) <<
+			       ": bad memo table limit: " << QUOTE(s));
+		}
+	    }
+	  else if (const char* s = isFlag(arg, "-memo-cache="))
+	    VisibleModule::setMemoCacheDirectory(s);
+	  else if (const char* s = isFlag(arg, "-profile-json="))
+	    interpreter.setProfileJsonFile(s);
+	  else if (const char* s = isFlag(arg, "-profile-folded="))
+	    {
+	      ProfileModule::setTimeProfiling(true);
+	      interpreter.setFoldedStackFile(s);
+	    }
+	  else if (const char* s = isFlag(arg, "-interpreter-ring-size="))
+	    {
+	      char *endptr;
+	      long m = strtol(s, &endptr, 10);
+	      if (endptr > s && *endptr == '\0' && m >= 0 && m <= INT_MAX / 1024)
+		InterpreterManagerSymbol::setRingCapacity(1024 * static_cast<size_t>(m));
+	      else
+		{
+		  IssueWarning(LineNumber(FileTable::COMMAND_LINE) <<
+			       ": bad interpreter ring size: " << QUOTE(s));
+		}
+	    }
+	  else if (const char* s = isFlag(arg, "-unifier-cache-limit="))
+	    {
+	      char *endptr;
+	      long m = strtol(s, &endptr, 10);
+	      if (endptr > s && *endptr == '\0' && m >= 0 && m <= INT_MAX)
+		UnifierCache::setMaxSize(m);
+	      else
+		{
+		  IssueWarning(LineNumber(FileTable::COMMAND_LINE) <<
+			       ": bad unifier cache limit: " << QUOTE(s));
+		}
+	    }
 	  else if (strcmp(arg, "--help") == 0)
 	    printHelp(argv[0]);
 	  else if (strcmp(arg, "--version") == 0)
@@ -162,6 +227,10 @@ main(int argc, char* argv[])
 	    cerr << getpid() << endl;
 	  else if (strcmp(arg, "-erewrite-loop-mode") == 0)
 	    interpreter.setFlag(Interpreter::EREWRITE_LOOP_MODE, true);
+	  else if (strcmp(arg, "-profile-time") == 0)
+	    ProfileModule::setTimeProfiling(true);
+	  else if (strcmp(arg, "-idle-gc") == 0)
+	    MemoryCell::setIdleCollection(true);
 	  else if (strcmp(arg, "-allow-processes") == 0)
 	    ProcessManagerSymbol::setAllowProcesses(true);
 	  else if (strcmp(arg, "-allow-files") == 0)
@@ -311,12 +380,21 @@ printHelp(const char* name)
     "  -xml-log=<filename>\tSet file in which to produce an xml log\n"
     "  -show-pid\t\tPrint process id to stderr before printing banner\n"
     "  -erewrite-loop-mode\tUse external object rewriting for loop mode\n"
+    "  -idle-gc\t\tCollect garbage early while waiting on external objects\n"
+    "  -interpreter-ring-size=<int>\tSet kilobytes of shared memory each way for each remote interpreter (0 disables)\n"
     "  -allow-processes\tAllow running arbitrary executables\n"
     "  -allow-files\t\tAllow operations on files\n"
     "  -allow-dir\t\tAllow operations on directories\n"
     "  -trust\t\tAllow all potentially risky capabilities\n"
     "  -assoc-unif-depth=<float>\tSet depth bound multiplier for associative unification\n"
     "  -latex-log=<filename>\tSet file in which to produce an LaTeX log\n"
+    "  -gc-slop=<float>\tSet minimum ratio of memory to live data after garbage collection\n"
+    "  -memo-limit=<int>\tFlush a module's memo table once it reaches this many dags\n"
+    "  -unifier-cache-limit=<int>\tSet bound on each module's variant unifier cache (0 disables)\n"
+    "  -memo-cache=<dir>\tSave memo tables in a directory and reuse them in later sessions\n"
+    "  -profile-time\t\tAdd wall-clock time per statement to profiles\n"
+    "  -profile-folded=<filename>\tAlso write profiled time as folded stacks for flame graphs\n"
+    "  -profile-json=<filename>\tAlso write profile and statistics as JSON when showing a profile\n"
     "Intended for developer use:\n"
     "  -debug\t\tPrint copious messages about internal state (debug build only)\n"
     "  -early-quit=<int>\tQuit abruptly after a given number of garbage collections\n"
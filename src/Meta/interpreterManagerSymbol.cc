@@ -25,6 +25,7 @@
 //
 #include <sys/types.h>
 #include <sys/wait.h>
+#include <sys/mman.h>
 #include <sstream>
 
 //      utility stuff
@@ -105,6 +106,7 @@
 #include "remoteInterpreter.cc"
 #include "remoteInterpreter2.cc"
 #include "remoteInterpreterNonblocking.cc"
+#include "sharedRing.cc"
 #include "miModule.cc"
 #include "miSort.cc"
 #include "miRewrite.cc"
@@ -412,6 +414,7 @@ InterpreterManagerSymbol::deleteInterpreter(DagNode* interpreterArg)
 		      //
 		      waitpid(i->second.processId, 0, 0);
 		      delete i->second.charArray;
+		      deleteSharedRegion(i->second.sharedRegion);
 		      remoteInterpreters.erase(i);
 		      return true;
 		    }
@@ -27,6 +27,7 @@
 #define _interpreterManagerSymbol_hh_
 #include <sys/types.h>
 #include <map>
+#include <atomic>
 #include "externalObjectManagerSymbol.hh"
 #include "pseudoThread.hh"
 #include "freeDagNode.hh"
@@ -60,14 +61,51 @@ public:
   bool handleManagerMessage(DagNode* message, ObjectSystemRewritingContext& context);
   bool handleMessage(DagNode* message, ObjectSystemRewritingContext& context);
   void cleanUp(DagNode* objectId);
+  //
+  //	Bytes of shared ring for each direction of each remote interpreter
+  //	created from now on; 0 means messages only go through sockets.
+  //
+  static void setRingCapacity(size_t nrBytes);
 
 private:
+  enum SharedMemory
+  {
+    DEFAULT_RING_CAPACITY = 1024 * 1024,
+    RING_HEADER_SIZE = 64  // keep consumed count on its own cache line
+  };
+  //
+  //	One end of a single producer, single consumer ring buffer in memory
+  //	shared with a forked remote interpreter. Messages that fit are written
+  //	into the ring and decoded in place; only their length goes through the
+  //	socket, which keeps messages in order. The shared header holds the
+  //	number of bytes consumed so the producer can see space being freed;
+  //	each end keeps its own position privately.
+  //
+  struct SharedRing
+  {
+    void init(char* region, size_t ringCapacity);
+    bool put(const string& message);
+    const char* get(size_t length);
+    void release(size_t length);
+
+    atomic<size_t>* consumed;
+    char* data;
+    size_t capacity;  // 0 if there is no ring
+    size_t position;  // total bytes produced or consumed at this end
+  };
+
   struct RemoteInterpreter
   {
     pid_t processId;
     int ioSocket;
     int errSocket;
     //
+    //	Shared memory for passing messages in each direction.
+    //
+    char* sharedRegion;  // 0 if rings are disabled
+    SharedRing toChild;
+    SharedRing fromChild;
+    //
     //	To handle nonblocking send.
     //
     char* charArray;  // full message
@@ -144,14 +182,25 @@ private:
   bool remoteHandleMessage(FreeDagNode* message,
 			   ObjectSystemRewritingContext& context,
 			   RemoteInterpreter* r);
-  void remoteHandleReply(RemoteInterpreter* r, const Rope& reply);
+  void remoteHandleReply(RemoteInterpreter* r, const char* encoding, size_t length);
 
-  void nonblockingSendMessage(RemoteInterpreter& ri, const Rope& message);
-  Rope receiveMessage(int socketId);
-  void sendMessage(int socketId, const Rope& message);
+  void nonblockingSendMessage(RemoteInterpreter& ri, const string& message);
+  static void readFully(int socketId, char* buffer, size_t length);
+  bool receiveMessage(int socketId,
+		      SharedRing& ring,
+		      string& buffer,
+		      const char*& encoding,
+		      size_t& length);
+  void sendMessage(int socketId, SharedRing& ring, const string& message);
+  static char* makeFramedMessage(const string& message, SharedRing& ring, size_t& nrBytes);
+  static bool makeSharedRegion(size_t ringCapacity, char*& region);
+  static void deleteSharedRegion(char* region);
+  static void deleteOtherSharedRegions(char* keep);
   bool outputWholeErrorLines(RemoteInterpreter* ri);
   
   void becomeRemoteInterpreter(int socketId,
+			       char* sharedRegion,
+			       size_t ringCapacity,
 			       MixfixModule* m,
 			       ObjectSystemRewritingContext& context);
   DagNode* handleMessage(FreeDagNode* message,
@@ -280,8 +329,17 @@ private:
 
   Vector<Interpreter*> interpreters;
   RemoteInterpreterMap remoteInterpreters;
+
+  static size_t ringCapacity;
+  static map<char*, size_t> sharedRegions;  // all regions mapped by this process
 };
 
+inline void
+InterpreterManagerSymbol::setRingCapacity(size_t nrBytes)
+{
+  ringCapacity = nrBytes;
+}
+
 inline RewritingContext*
 InterpreterManagerSymbol::term2RewritingContext(Term* term, RewritingContext& context)
 {
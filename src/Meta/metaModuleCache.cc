@@ -52,19 +52,34 @@
 #include "metaModuleCache.hh"
 
 int MetaModuleCache::maxSize = UNDEFINED;
+int MetaModuleCache::maxWeight = UNDEFINED;
+Int64 MetaModuleCache::nrHits = 0;
+Int64 MetaModuleCache::nrMisses = 0;
+Int64 MetaModuleCache::nrEvictions = 0;
 
 MetaModuleCache::MetaModuleCache()
 {
   if (maxSize == UNDEFINED)
     {
-      maxSize = DEFAULT_MAX_SIZE;
-      if (const char* value = getenv("MAUDE_META_MODULE_CACHE_SIZE"))
-	{
-	  int size = atoi(value);
-	  if (size >= MIN_MAX_SIZE && size <= MAX_MAX_SIZE)
-	    maxSize = size;
-	}
+      maxSize = getLimit("MAUDE_META_MODULE_CACHE_SIZE",
+			 DEFAULT_MAX_SIZE, MIN_MAX_SIZE, MAX_MAX_SIZE);
+      maxWeight = getLimit("MAUDE_META_MODULE_CACHE_WEIGHT",
+			   DEFAULT_MAX_WEIGHT, MIN_MAX_WEIGHT, INT_MAX);
     }
+  totalWeight = 0;
+}
+
+int
+MetaModuleCache::getLimit(const char* variable, int defaultLimit, int minLimit, int maxLimit)
+{
+  if (const char* value = getenv(variable))
+    {
+      char* endptr;
+      long limit = strtol(value, &endptr, 10);
+      if (endptr > value && *endptr == '\0' && limit >= minLimit && limit <= maxLimit)
+	return limit;
+    }
+  return defaultLimit;
 }
 
 MetaModuleCache::~MetaModuleCache()
@@ -89,66 +104,108 @@ MetaModuleCache::Pair::clear()
 MetaModule*
 MetaModuleCache::find(DagNode* dag)
 {
-  int nrPairs = cache.length();
   //
-  //	First check if we've downed this is exact dag.
+  //	We check if we've downed this exact dag or an equal dag. Surprisingly
+  //	the latter is a very common case. Only cached dags with the same hash
+  //	value can match, so the cost of a miss doesn't grow with the cache.
   //
-  for (int i = 0; i < nrPairs; i++)
+  if (!cache.empty())
     {
-      if (dag == cache[i].dag->getNode())
-	return moveToFront(i);
-    }
-  //
-  //	Then check if we've downed an equal dag. Surprisingly this is a very common case.
-  //	It's tempting to compare on getHashValue() as a filter before the expensive equal() 
-  //	call but benchmarking shows that it saves too few calls to pay for itself.
-  //
-  for (int i = 0; i < nrPairs; i++)
-    {
-      DagNode* cached = cache[i].dag->getNode();
-      if (dag->equal(cached))
-	return moveToFront(i);
+      pair<HashIndex::iterator, HashIndex::iterator> range =
+	hashIndex.equal_range(dag->getHashValue());
+      for (HashIndex::iterator i = range.first; i != range.second; ++i)
+	{
+	  DagNode* cachedDag = i->second->dag->getNode();
+	  if (dag == cachedDag || dag->equal(cachedDag))
+	    return moveToFront(i->second);
+	}
     }
+  ++nrMisses;
   return 0;
 }
 
 MetaModule*
-MetaModuleCache::moveToFront(int chosen)
+MetaModuleCache::moveToFront(PairList::iterator chosen)
 {
-  DebugAdvisory("cache hit (" << cache[chosen].module <<
-		") for #" << chosen << " cache size = " << cache.length());
-  if (chosen == 0)
-    return cache[0].module;
-  Pair p = cache[chosen];
-  for (int i = chosen; i > 0; i--)
-    cache[i] = cache[i - 1];
-  cache[0] = p;
-  return p.module;
+  DebugAdvisory("cache hit (" << chosen->module <<
+		") cache size = " << cache.size());
+  ++nrHits;
+  cache.splice(cache.begin(), cache, chosen);
+  return chosen->module;
+}
+
+void
+MetaModuleCache::unindex(PairList::iterator victim)
+{
+  pair<HashIndex::iterator, HashIndex::iterator> range =
+    hashIndex.equal_range(victim->hashValue);
+  for (HashIndex::iterator i = range.first; i != range.second; ++i)
+    {
+      if (i->second == victim)
+	{
+	  hashIndex.erase(i);
+	  return;
+	}
+    }
+  CantHappen("cache entry missing from hash index");
 }
 
 void 
 MetaModuleCache::insert(DagNode* dag, MetaModule* module)
 {
   DebugAdvisory("cache miss (" << module <<
-		"), cache size = " << cache.length());
-  int size = cache.length();
-  if (size == maxSize)
-    cache[--size].clear();
-  else
-    cache.expandTo(size + 1);
-  for (int i = size; i > 0; i--)
-    cache[i] = cache[i - 1];
-  cache[0].dag = new DagRoot(dag);
-  cache[0].module = module;
+		"), cache size = " << cache.size());
+  //
+  //	Evict least recently used modules until the new one fits. We always
+  //	keep the new module, even if it is heavier than maxWeight by itself.
+  //
+  int weight = computeWeight(module);
+  while (!cache.empty() &&
+	 (static_cast<int>(cache.size()) == maxSize || totalWeight + weight > maxWeight))
+    {
+      PairList::iterator victim = --cache.end();
+      unindex(victim);
+      totalWeight -= victim->weight;
+      victim->clear();
+      cache.erase(victim);
+      ++nrEvictions;
+    }
+  cache.push_front(Pair());
+  Pair& p = cache.front();
+  p.dag = new DagRoot(dag);
+  p.module = module;
+  p.hashValue = dag->getHashValue();
+  p.weight = weight;
+  hashIndex.insert(HashIndex::value_type(p.hashValue, cache.begin()));
+  totalWeight += weight;
+}
+
+int
+MetaModuleCache::computeWeight(MetaModule* module)
+{
+  return module->getSymbols().size() +
+    module->getSortConstraints().size() +
+    module->getEquations().size() +
+    module->getRules().size() +
+    module->getStrategyDefinitions().size();
 }
 
 void 
 MetaModuleCache::flush()
 {
-  int nrPairs = cache.length();
-  for (int i = 0; i < nrPairs; i++)
-    cache[i].clear();
+  for (Pair& p : cache)
+    p.clear();
   cache.clear();
+  hashIndex.clear();
+  totalWeight = 0;
+}
+
+void
+MetaModuleCache::showStatistics(ostream& s)
+{
+  s << "Meta-module cache hits: " << nrHits <<
+    "\tmisses: " << nrMisses <<
+    "\tevictions: " << nrEvictions << endl;
 }
 
 void
@@ -158,15 +215,14 @@ MetaModuleCache::regretToInform(Entity* doomedEntity)
   //
   //	Must remove doomed module from cache if it's there.
   //
-  int nrPairs = cache.length();
-  for (int i = 0; i < nrPairs; i++)
+  for (PairList::iterator i = cache.begin(); i != cache.end(); ++i)
     {
-      if (doomedModule == cache[i].module)
+      if (doomedModule == i->module)
 	{
-	  delete cache[i].dag;
-	  for (++i; i < nrPairs; ++i)
-	    cache[i - 1] = cache[i];
-	  cache.contractTo(nrPairs - 1);
+	  unindex(i);
+	  delete i->dag;
+	  totalWeight -= i->weight;
+	  cache.erase(i);
 	  return;
 	}
     }
@@ -25,6 +25,8 @@
 //
 #ifndef _metaModuleCache_hh_
 #define _metaModuleCache_hh_
+#include <list>
+#include <map>
 #include "importModule.hh"
 #include "metaModule.hh"
 
@@ -39,6 +41,10 @@ public:
   MetaModule* find(DagNode* dag);
   void insert(DagNode* dag, MetaModule* module);
   void flush();
+  //
+  //	Hits, misses and evictions summed over all caches.
+  //
+  static void showStatistics(ostream& s);
 
   //
   //	Attempt to purge a single state derived from class T from the
@@ -50,9 +56,17 @@ public:
 private:
   enum Sizes
     {
-      DEFAULT_MAX_SIZE = 4, //  this is the normal maximum size of the cache
+      DEFAULT_MAX_SIZE = 256, //  this is the normal maximum size of the cache
       MIN_MAX_SIZE = 1,  // this is the smallest custom maximum size allowed
-      MAX_MAX_SIZE = 1024  // this is the largest custom maximum size allowed
+      MAX_MAX_SIZE = 65536,  // this is the largest custom maximum size allowed
+      //
+      //	Cached modules can be large, so we also bound the total weight
+      //	of the cache, where the weight of a module is the number of
+      //	symbols and statements it has; this is a rough proxy for the
+      //	memory it uses.
+      //
+      DEFAULT_MAX_WEIGHT = 100000,
+      MIN_MAX_WEIGHT = 1
     };
 
   struct Pair
@@ -61,13 +75,32 @@ private:
 
     DagRoot* dag;
     MetaModule* module;
+    size_t hashValue;  // of dag, so we only call equal() on likely matches
+    int weight;
   };
+  //
+  //	Pairs are kept in least recently used order, most recent first, and
+  //	indexed by hash value so that neither a hit nor a miss needs a scan.
+  //
+  typedef list<Pair> PairList;
+  typedef multimap<size_t, PairList::iterator> HashIndex;
 
   void regretToInform(Entity* doomedEntity);
-  MetaModule* moveToFront(int chosen);
+  MetaModule* moveToFront(PairList::iterator chosen);
+  void unindex(PairList::iterator victim);
+
+  static int computeWeight(MetaModule* module);
+  static int getLimit(const char* variable, int defaultLimit, int minLimit, int maxLimit);
 
   static int maxSize;
-  Vector<Pair> cache;
+  static int maxWeight;
+  static Int64 nrHits;
+  static Int64 nrMisses;
+  static Int64 nrEvictions;
+
+  PairList cache;
+  HashIndex hashIndex;
+  int totalWeight;
 };
 
 template<class T>
@@ -94,10 +94,18 @@ MetaPreModule::getFlatModule()
       //	have been compiled since it relied on VariableInfo being filled out.
       //
       m->checkFreshVariableNames();
+      m->loadMemoCache();
     }
   return m;  // could be null pointer
 }
 
+void
+MetaPreModule::saveMemoCache()
+{
+  if (flatModule != 0)
+    flatModule->saveMemoCache();
+}
+
 VisibleModule*
 MetaPreModule::getFlatSignature()
 {
@@ -42,6 +42,7 @@ public:
   const ModuleDatabase::ImportMap* getAutoImports() const;
   VisibleModule* getFlatSignature();
   VisibleModule* getFlatModule();
+  void saveMemoCache();
   //
   //	Specific to MetaPreModule.
   //
@@ -110,19 +110,39 @@ InterpreterManagerSymbol::createRemoteInterpreter(FreeDagNode* originalMessage,
       return true;
     }
   //
+  //	Shared memory for passing large messages.
+  //
+  size_t capacity = ringCapacity;
+  char* sharedRegion;
+  if (!makeSharedRegion(capacity, sharedRegion))
+    {
+      //
+      //	Must not leak file descriptors.
+      //
+      int errNr = errno;
+      close(errSockets[0]);
+      close(errSockets[1]);
+      close(ioSockets[0]);
+      close(ioSockets[1]);
+      errorReply(strerror(errNr), originalMessage, context);
+      return true;
+    }
+  //
   //	Fork a new Maude interpreter.
   //
   pid_t pid = fork();
   if (pid == -1)
     {
       //
-      //	Must not leak file descriptors.
+      //	Must not leak file descriptors or shared memory.
       //
+      int errNr = errno;
+      deleteSharedRegion(sharedRegion);
       close(errSockets[0]);
       close(errSockets[1]);
       close(ioSockets[0]);
       close(ioSockets[1]);
-      errorReply(strerror(errno), originalMessage, context);
+      errorReply(strerror(errNr), originalMessage, context);
       return true;
     }
   Symbol* s = originalMessage->symbol();
@@ -144,7 +164,8 @@ InterpreterManagerSymbol::createRemoteInterpreter(FreeDagNode* originalMessage,
       //	tracing, break points, profiling and the print attribute.
       //
       RewritingContext::setTraceStatus(false);
-      becomeRemoteInterpreter(ioSockets[1], m, context);  // doesn't return
+      deleteOtherSharedRegions(sharedRegion);
+      becomeRemoteInterpreter(ioSockets[1], sharedRegion, capacity, m, context);  // doesn't return
     }
   //
   //	We're the parent; record details of process and sockets.
@@ -155,6 +176,9 @@ InterpreterManagerSymbol::createRemoteInterpreter(FreeDagNode* originalMessage,
   ri.processId = pid;
   ri.ioSocket = ioSockets[0];
   ri.errSocket = errSockets[0];
+  ri.sharedRegion = sharedRegion;
+  ri.toChild.init(sharedRegion, capacity);
+  ri.fromChild.init(sharedRegion + RING_HEADER_SIZE + capacity, capacity);
   ri.charArray = 0;
   ri.unsent = 0;
   ri.nrUnsent = 0;
@@ -199,8 +223,9 @@ InterpreterManagerSymbol::remoteHandleMessage(FreeDagNode* message,
       return false;
     }
   DebugAdvisory("sending request " << message);
-  Rope text = r->module->serialize(message);
-  nonblockingSendMessage(*r, text);
+  string encoding;
+  r->module->serializeBinary(message, encoding);
+  nonblockingSendMessage(*r, encoding);
   //
   //	We don't want to wait for a reply; instead we just increment
   //	the count of replies we are owed, and if this is the first one,
@@ -222,9 +247,9 @@ InterpreterManagerSymbol::remoteHandleMessage(FreeDagNode* message,
 }
 
 void
-InterpreterManagerSymbol::remoteHandleReply(RemoteInterpreter* r, const Rope& reply)
+InterpreterManagerSymbol::remoteHandleReply(RemoteInterpreter* r, const char* encoding, size_t length)
 {
-  DagNode* replyDag = r->module->deserialize(reply);
+  DagNode* replyDag = r->module->deserializeBinary(encoding, length);
   DagNode* target = safeCast(FreeDagNode*, replyDag)->getArgument(0);
   r->savedContext->bufferMessage(target, replyDag);
   --(r->nrPendingReplies);
@@ -299,5 +324,6 @@ InterpreterManagerSymbol::doChildExit(pid_t childPid)
   //	Delete interpreter.
   //
   delete i->second.charArray;
+  deleteSharedRegion(i->second.sharedRegion);
   remoteInterpreters.erase(i);
 }
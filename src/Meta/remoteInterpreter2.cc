@@ -23,60 +23,29 @@
 //
 //      Remote metaInterpreters: child side
 //
-static constexpr char EOT = '\004';
 
-Rope
-InterpreterManagerSymbol::receiveMessage(int socketId)
-{
-  static char buffer[READ_BUFFER_SIZE];
-  static ssize_t nextValidIndex = 0;
-  static ssize_t n = 0;
-
-  Rope message;
-  //
-  //	Left over characters from last read?
-  //
-  if (nextValidIndex != 0)
-    {
-      //
-      //	May be many messages terminated by EOTs.
-      //
-      for (int i = nextValidIndex; i < n; ++i)
-	{
-	  if (buffer[i] == EOT)
-	    {
-	      //
-	      //	Saw end of a message.
-	      //
-	      message = Rope(buffer + nextValidIndex, i - nextValidIndex);
-	      if (i + 1 < n)
-		{
-		  //
-		  //	More characters beyond message so save them.
-		  //
-		  nextValidIndex = i + 1;
-		}
-	      else
-		{
-		  //
-		  //	No more characters.
-		  //
-		  nextValidIndex = 0;
-		}
-	      return message;
-	    }
-	} 
-      message = Rope(buffer + nextValidIndex, n - nextValidIndex);
-    }
+//
+//	Messages are dags in the binary encoding produced by
+//	MixfixModule::serializeBinary(), which may contain any byte, so each
+//	message is preceded by a header holding its length. Both ends are
+//	the same executable so the header is in native byte order. If the
+//	top bit of the header is set, the message itself was placed in the
+//	shared ring rather than following the header.
+//
+typedef size_t MessageHeader;
+static constexpr MessageHeader IN_SHARED_RING = ~(~static_cast<MessageHeader>(0) >> 1);
 
-  for (;;)
+void
+InterpreterManagerSymbol::readFully(int socketId, char* buffer, size_t length)
+{
+  while (length > 0)
     {
       //
-      //	Get whatever characters are available, restarting
-      //	interrupted calls.
+      //	Restart interrupted calls.
       //
+      ssize_t n;
       do
-	n = read(socketId, buffer, READ_BUFFER_SIZE);
+	n = read(socketId, buffer, length);
       while (n == -1 && errno == EINTR);
       Assert(n != -1, "unexpected read failure: " << strerror(errno));
       if (n == 0)
@@ -87,47 +56,41 @@ InterpreterManagerSymbol::receiveMessage(int socketId)
 	  //
 	  exit(UserLevelRewritingContext::SOCKET_CLOSED);
 	}
-      for (ssize_t i = 0; i < n; ++i)
-	{
-	  if (buffer[i] == EOT)
-	    {
-	      //
-	      //	Saw end of a message.
-	      //
-	      message += Rope(buffer, i);
-	      if (i + 1 < n)
-		{
-		  //
-		  //	More characters beyond message so save them.
-		  //
-		  nextValidIndex = i + 1;
-		}
-	      else
-		{
-		  //
-		  //	No more characters.
-		  //
-		  nextValidIndex = 0;
-		}
-	      return message;
-	    }
-	}
-      //
-      //	Add all characters.
-      //
-      message += Rope(buffer, n);
+      buffer += n;
+      length -= n;
     }
-  return message;  // dummy
+}
+
+bool
+InterpreterManagerSymbol::receiveMessage(int socketId,
+					 SharedRing& ring,
+					 string& buffer,
+					 const char*& encoding,
+					 size_t& length)
+{
+  //
+  //	Returns true if the message is in the shared ring, in which case
+  //	the caller must release it once it has been decoded.
+  //
+  MessageHeader header;
+  readFully(socketId, reinterpret_cast<char*>(&header), sizeof(header));
+  length = header & ~IN_SHARED_RING;
+  if (header & IN_SHARED_RING)
+    {
+      encoding = ring.get(length);
+      return true;
+    }
+  buffer.resize(length);
+  readFully(socketId, &buffer[0], length);
+  encoding = buffer.data();
+  return false;
 }
 
 void
-InterpreterManagerSymbol::sendMessage(int socketId, const Rope& message)
+InterpreterManagerSymbol::sendMessage(int socketId, SharedRing& ring, const string& message)
 {
-  Rope::size_type length = message.length();
-  char* charArray = message.makeZeroTerminatedString();
-  charArray[length] = EOT;  // change NUL to EOT
-  
-  ssize_t nrUnsent = length + 1;
+  size_t nrUnsent;
+  char* charArray = makeFramedMessage(message, ring, nrUnsent);
   char* p = charArray;
   do
     {
@@ -142,30 +105,65 @@ InterpreterManagerSymbol::sendMessage(int socketId, const Rope& message)
   delete [] charArray;
 }
 
+char*
+InterpreterManagerSymbol::makeFramedMessage(const string& message, SharedRing& ring, size_t& nrBytes)
+{
+  MessageHeader length = message.size();
+  if (ring.put(message))
+    {
+      //
+      //	Only the header need go through the socket.
+      //
+      MessageHeader header = length | IN_SHARED_RING;
+      char* charArray = new char[sizeof(header)];
+      memcpy(charArray, &header, sizeof(header));
+      nrBytes = sizeof(header);
+      return charArray;
+    }
+  char* charArray = new char[sizeof(length) + length];
+  memcpy(charArray, &length, sizeof(length));
+  memcpy(charArray + sizeof(length), message.data(), length);
+  nrBytes = sizeof(length) + length;
+  return charArray;
+}
+
 void
 InterpreterManagerSymbol::becomeRemoteInterpreter(int socketId,
+						  char* sharedRegion,
+						  size_t ringCapacity,
 						  MixfixModule* m,
 						  ObjectSystemRewritingContext& context)
 {
   Interpreter* interpreter = new Interpreter;
+  //
+  //	The parent produces into the first ring and consumes from the second.
+  //
+  SharedRing fromParent;
+  fromParent.init(sharedRegion, ringCapacity);
+  SharedRing toParent;
+  toParent.init(sharedRegion + RING_HEADER_SIZE + ringCapacity, ringCapacity);
+  string buffer;
 
   for (;;)
     {
-      Rope request = receiveMessage(socketId);
+      const char* encoding;
+      size_t length;
+      bool inRing = receiveMessage(socketId, fromParent, buffer, encoding, length);
       //
       //	Deserialized dag is vulnerable to the garbage collector so
       //	protect it.
       //
-      DagRoot requestDag(m->deserialize(request));
+      DagRoot requestDag(m->deserializeBinary(encoding, length));
+      if (inRing)
+	fromParent.release(length);
       //
       //	We only support message symbols in the free theory.
       //
       DagNode* replyDag = handleMessage(safeCast(FreeDagNode*, requestDag.getNode()),
 					context,
 					interpreter);
-      Rope reply = m->serialize(replyDag);
-      //cerr << "reply = " << reply << endl;
-      sendMessage(socketId, reply);
+      m->serializeBinary(replyDag, buffer);
+      sendMessage(socketId, toParent, buffer);
     }
 }
 
@@ -21,18 +21,16 @@
 */
 
 void
-InterpreterManagerSymbol::nonblockingSendMessage(RemoteInterpreter& ri, const Rope& message)
+InterpreterManagerSymbol::nonblockingSendMessage(RemoteInterpreter& ri, const string& message)
 {
   Assert(ri.nrUnsent == 0, "can't send another message while previous one is being sent");
   //
   //	Send as much as we can, and send the rest using call-backs.
   //
   int socketId = ri.ioSocket;
-  Rope::size_type length = message.length();
-  char* charArray = message.makeZeroTerminatedString();
-  charArray[length] = EOT;  // change NUL to EOT
-
-  ssize_t nrUnsent = length + 1;
+  size_t nrBytes;
+  char* charArray = makeFramedMessage(message, ri.toChild, nrBytes);
+  ssize_t nrUnsent = nrBytes;
   char* p = charArray;
   //
   //	Restart interrupted calls.
@@ -195,30 +193,38 @@ InterpreterManagerSymbol::doRead(int fd)
       if (n > 0)
 	{
 	  //
-	  //	We got characters; look for an EOT that signals the end
-	  //	of a DAG, then we can dispatch the message it encodes.
+	  //	We got characters; each time we have a whole message, as
+	  //	given by its length header, we can dispatch the reply it encodes.
 	  //
-	  ssize_t messageStart = 0;
-	  for (ssize_t i = 0; i < n; ++i)
+	  ri->incomingMessage += Rope(buffer, n);
+	  for (;;)
 	    {
-	      if (buffer[i] == EOT)
+	      Rope::size_type nrAvailable = ri->incomingMessage.length();
+	      MessageHeader header;
+	      if (nrAvailable < sizeof(header))
+		break;
+	      ri->incomingMessage.substr(0, sizeof(header)).copy(reinterpret_cast<char*>(&header));
+	      size_t length = header & ~IN_SHARED_RING;
+	      if (header & IN_SHARED_RING)
 		{
-		  ri->incomingMessage += Rope(buffer + messageStart, i - messageStart);
-		  remoteHandleReply(ri, ri->incomingMessage);
-		  ri->incomingMessage.clear();
-		  messageStart = i + 1;
+		  //
+		  //	Reply is waiting in the shared ring; decode it in place.
+		  //
+		  remoteHandleReply(ri, ri->fromChild.get(length), length);
+		  ri->fromChild.release(length);
+		  ri->incomingMessage = ri->incomingMessage.substr(sizeof(header), nrAvailable - sizeof(header));
+		  continue;
 		}
+	      Rope::size_type messageEnd = sizeof(header) + length;
+	      if (nrAvailable < messageEnd)
+		break;
+	      string reply(length, '\0');
+	      ri->incomingMessage.substr(sizeof(header), length).copy(&reply[0]);
+	      remoteHandleReply(ri, reply.data(), length);
+	      ri->incomingMessage = ri->incomingMessage.substr(messageEnd, nrAvailable - messageEnd);
 	    }
-	  ssize_t nrCharsLeft = n - messageStart;
-	  if (nrCharsLeft > 0)
-	    {
-	      //
-	      //	Either we didn't see an EOT or there are characters beyond
-	      //	the last EOT; the remaining characters the start of another DAG.
-	      //	
-	      ri->incomingMessage += Rope(buffer + messageStart, nrCharsLeft);
-	      Assert(ri->nrPendingReplies > 0, "partial message yet no pending replies");
-	    }
+	  Assert(ri->incomingMessage.empty() || ri->nrPendingReplies > 0,
+		 "partial message yet no pending replies");
 	}
       else
 	{
@@ -282,18 +288,17 @@ InterpreterManagerSymbol::outputWholeErrorLines(RemoteInterpreter* ri)
 	    {
 	      if (buffer[i] == '\n')
 		{
-		  ri->incomingMessage += Rope(buffer + messageStart, i - messageStart);
+		  ri->incomingErrorLine += Rope(buffer + messageStart, i - messageStart);
 		  //cerr << "----> ";
-		  cerr << ri->incomingMessage << endl;
-		  ri->incomingMessage.clear();
+		  cerr << ri->incomingErrorLine << endl;
+		  ri->incomingErrorLine.clear();
 		  messageStart = i + 1;
 		}
 	    }
 	  ssize_t nrCharsLeft = n - messageStart;
 	  if (nrCharsLeft > 0)
 	    {
-	      ri->incomingMessage += Rope(buffer + messageStart, nrCharsLeft);
-	      Assert(ri->nrPendingReplies > 0, "partial message yet no pending replies");
+	      ri->incomingErrorLine += Rope(buffer + messageStart, nrCharsLeft);
 	    }
 	}
       else
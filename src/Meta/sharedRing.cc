@@ -0,0 +1,154 @@
+/*
+
+    This file is part of the Maude 3 interpreter.
+
+    Copyright 2026 SRI International, Menlo Park, CA 94025, USA.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.
+
+*/
+
+//
+//      Shared memory ring buffers for passing messages to and from
+//	remote interpreters.
+//
+//	A region is mapped before fork() so that the parent and child see
+//	the same memory. It holds two rings, one for each direction. Each
+//	ring starts with a header holding the number of bytes its consumer
+//	has finished with; the rest is message data. Pages are only backed
+//	once a message reaches them, and messages too big for the free space
+//	go through the socket, so the capacity trades memory for copying.
+//
+//	A message is never split across the end of a ring so that it can be
+//	decoded in place; if it won't fit before the end, the producer skips
+//	to the start. The consumer learns the length of each message from the
+//	socket and applies the same rule, so positions need not be sent.
+//
+
+size_t InterpreterManagerSymbol::ringCapacity = DEFAULT_RING_CAPACITY;
+map<char*, size_t> InterpreterManagerSymbol::sharedRegions;
+
+bool
+InterpreterManagerSymbol::makeSharedRegion(size_t ringCapacity, char*& region)
+{
+  //
+  //	Returns false with errno set on failure; a capacity of 0 gives a
+  //	null region.
+  //
+  region = 0;
+  if (ringCapacity == 0)
+    return true;
+  size_t ringSize = RING_HEADER_SIZE + ringCapacity;
+  void* mapped = mmap(0, 2 * ringSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (mapped == MAP_FAILED)
+    return false;
+  region = static_cast<char*>(mapped);
+  new(region) atomic<size_t>(0);
+  new(region + ringSize) atomic<size_t>(0);
+  sharedRegions[region] = ringCapacity;
+  return true;
+}
+
+void
+InterpreterManagerSymbol::deleteSharedRegion(char* region)
+{
+  //
+  //	A region is missing if it belonged to a sibling and we unmapped it
+  //	when we were forked.
+  //
+  map<char*, size_t>::iterator i = sharedRegions.find(region);
+  if (i != sharedRegions.end())
+    {
+      munmap(region, 2 * (RING_HEADER_SIZE + i->second));
+      sharedRegions.erase(i);
+    }
+}
+
+void
+InterpreterManagerSymbol::deleteOtherSharedRegions(char* keep)
+{
+  //
+  //	A newly forked child inherits the regions of all its siblings; it
+  //	must not keep their memory alive, or touch it.
+  //
+  for (map<char*, size_t>::iterator i = sharedRegions.begin(); i != sharedRegions.end();)
+    {
+      map<char*, size_t>::iterator next = i;
+      ++next;
+      if (i->first != keep)
+	{
+	  munmap(i->first, 2 * (RING_HEADER_SIZE + i->second));
+	  sharedRegions.erase(i);
+	}
+      i = next;
+    }
+}
+
+void
+InterpreterManagerSymbol::SharedRing::init(char* region, size_t ringCapacity)
+{
+  if (region == 0)
+    {
+      consumed = 0;
+      data = 0;
+      capacity = 0;
+    }
+  else
+    {
+      consumed = reinterpret_cast<atomic<size_t>*>(region);
+      data = region + RING_HEADER_SIZE;
+      capacity = ringCapacity;
+    }
+  position = 0;
+}
+
+bool
+InterpreterManagerSymbol::SharedRing::put(const string& message)
+{
+  size_t length = message.size();
+  if (capacity == 0 || length > capacity)
+    return false;  // caller must send message through socket
+  size_t offset = position % capacity;
+  size_t skip = (offset + length > capacity) ? capacity - offset : 0;
+  //
+  //	Acquire ensures the consumer is done reading the space we reuse.
+  //
+  size_t inUse = position - consumed->load(memory_order_acquire);
+  if (skip + length > capacity - inUse)
+    return false;  // caller must send message through socket
+  position += skip;
+  memcpy(data + position % capacity, message.data(), length);
+  position += length;
+  return true;
+}
+
+const char*
+InterpreterManagerSymbol::SharedRing::get(size_t length)
+{
+  size_t offset = position % capacity;
+  if (offset + length > capacity)
+    {
+      position += capacity - offset;
+      offset = 0;
+    }
+  return data + offset;
+}
+
+void
+InterpreterManagerSymbol::SharedRing::release(size_t length)
+{
+  position += length;
+  consumed->store(position, memory_order_release);
+}
@@ -0,0 +1,336 @@
+/*
+
+    This file is part of the Maude 3 interpreter.
+
+    Copyright 2026 SRI International, Menlo Park, CA 94025, USA.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.
+
+*/
+
+//
+//	Routines for serializing a dag to a compact binary string and back.
+//
+//	This encoding is intended for shipping large dags between a process
+//	and its forked copies, where the text encoding produced by
+//	serialize() spends most of its time formatting and lexing decimal
+//	numbers. Like the text encoding it is only meaningful to a module
+//	with the same symbol table, and it is trusted; it is not a storage
+//	format.
+//
+//	Dag nodes are emitted in post-order, each being given the next
+//	sequential index, so that shared subdags are emitted once and the
+//	root is the last node. All numbers are unsigned LEB128 varints.
+//	Each node starts with a tag byte:
+//
+//	  REGULAR		symbol index
+//	  POLYMORPH		polymorph index, kind index
+//	  EAGER/LAZY_SORT_TEST	sort index
+//	  VARIABLE		sort index, name length, name bytes
+//
+//	Regular and polymorph nodes are then followed by a payload that
+//	depends on the symbol type:
+//
+//	  ITER			byte count, big-endian magnitude bytes
+//	  FLOAT			8 bytes holding the bit pattern of the double
+//	  STRING		length, raw bytes of the string
+//	  QUOTED_IDENTIFIER	length, bytes of the identifier name
+//	  SMT_NUMBER_SYMBOL	length, decimal rational
+//
+//	and then by the number of arguments. Arguments (including the
+//	argument of a sort test) are given as the distance back from the
+//	index of the current node, which is nearly always a single byte.
+//
+
+enum BinaryTag
+  {
+    BINARY_REGULAR,
+    BINARY_POLYMORPH,
+    BINARY_EAGER_SORT_TEST,
+    BINARY_LAZY_SORT_TEST,
+    BINARY_VARIABLE
+  };
+
+static inline void
+appendVarint(string& accumulator, size_t value)
+{
+  while (value >= 0x80)
+    {
+      accumulator += static_cast<char>((value & 0x7f) | 0x80);
+      value >>= 7;
+    }
+  accumulator += static_cast<char>(value);
+}
+
+static inline void
+appendBytes(string& accumulator, const char* bytes, size_t length)
+{
+  appendVarint(accumulator, length);
+  accumulator.append(bytes, length);
+}
+
+void
+MixfixModule::serializeBinary(DagNode* dagNode, string& encoding)
+{
+  PointerSet visited;
+  encoding.clear();
+  binaryVisit(dagNode, visited, encoding);
+}
+
+int
+MixfixModule::binaryVisit(DagNode* dagNode, PointerSet& visited, string& accumulator)
+{
+  int index = visited.pointer2Index(dagNode);
+  if (index != NONE)
+    return index;  // already serialized
+  //
+  //	Post-order traversal - serialize arguments first.
+  //
+  Vector<int> argIndices;
+  for(DagArgumentIterator a(*dagNode); a.valid(); a.next())
+    argIndices.append(binaryVisit(a.argument(), visited, accumulator));
+  //
+  //	The index this node will be given.
+  //
+  index = visited.cardinality();
+
+  Symbol* symbol = dagNode->symbol();
+  int indexWithinModule = symbol->getIndexWithinModule();
+  SymbolType type = symbolInfo[indexWithinModule].symbolType;
+
+  if (type.getBasicType() == SymbolType::SORT_TEST)
+    {
+      //
+      //	Sort test symbols and variable symbols may not exist in
+      //	the other process, so as in serialize() we send sorts instead.
+      //
+      SortTestSymbol* st = safeCast(SortTestSymbol*, symbol);
+      accumulator += static_cast<char>(st->eager() ? BINARY_EAGER_SORT_TEST : BINARY_LAZY_SORT_TEST);
+      appendVarint(accumulator, st->sort()->getIndexWithinModule());
+      appendVarint(accumulator, index - argIndices[0]);
+      return visited.insert(dagNode);
+    }
+  if (type.getBasicType() == SymbolType::VARIABLE)
+    {
+      VariableSymbol* vs = safeCast(VariableSymbol*, symbol);
+      accumulator += static_cast<char>(BINARY_VARIABLE);
+      appendVarint(accumulator, vs->getSort()->getIndexWithinModule());
+      const char* name = Token::name(safeCast(VariableDagNode*, dagNode)->id());
+      appendBytes(accumulator, name, strlen(name));
+      return visited.insert(dagNode);
+    }
+
+  short polymorphIndex = symbolInfo[indexWithinModule].polymorphIndex;
+  if (polymorphIndex != NONE)
+    {
+      Polymorph& p = polymorphs[polymorphIndex];
+      int kindIndex = 0;
+      while (p.instantiations[kindIndex] != symbol)
+	++kindIndex;
+      accumulator += static_cast<char>(BINARY_POLYMORPH);
+      appendVarint(accumulator, polymorphIndex);
+      appendVarint(accumulator, kindIndex);
+    }
+  else
+    {
+      accumulator += static_cast<char>(BINARY_REGULAR);
+      appendVarint(accumulator, indexWithinModule);
+    }
+
+  if (type.hasFlag(SymbolType::ITER))
+    {
+      const mpz_class& number = safeCast(S_DagNode*, dagNode)->getNumber();
+      size_t nrBytes = (mpz_sizeinbase(number.get_mpz_t(), 2) + 7) / 8;
+      appendVarint(accumulator, nrBytes);
+      size_t start = accumulator.size();
+      accumulator.resize(start + nrBytes);
+      size_t count;
+      mpz_export(&accumulator[start], &count, 1, 1, 1, 0, number.get_mpz_t());
+      Assert(count == nrBytes, "mpz_export() wrote " << count << " bytes, expected " << nrBytes);
+    }
+
+  switch (type.getBasicType())
+    {
+    case SymbolType::FLOAT:
+      {
+	//
+	//	We send the bit pattern in the native byte order since the
+	//	receiver is a fork() of this process.
+	//
+	double d = safeCast(FloatDagNode*, dagNode)->getValue();
+	char bytes[sizeof(d)];
+	memcpy(bytes, &d, sizeof(d));
+	accumulator.append(bytes, sizeof(d));
+	break;
+      }
+    case SymbolType::STRING:
+      {
+	const Rope& value = safeCast(StringDagNode*, dagNode)->getValue();
+	Rope::size_type length = value.length();
+	appendVarint(accumulator, length);
+	size_t start = accumulator.size();
+	accumulator.resize(start + length);
+	if (length > 0)
+	  value.copy(&accumulator[start]);
+	break;
+      }
+    case SymbolType::QUOTED_IDENTIFIER:
+      {
+	const char* name = Token::name(safeCast(QuotedIdentifierDagNode*, dagNode)->getIdIndex());
+	appendBytes(accumulator, name, strlen(name));
+	break;
+      }
+    case SymbolType::SMT_NUMBER_SYMBOL:
+      {
+	string ts = safeCast(SMT_NumberDagNode*, dagNode)->getValue().get_str();
+	appendBytes(accumulator, ts.c_str(), ts.size());
+	break;
+      }
+    }
+
+  int nrArgs = argIndices.size();
+  appendVarint(accumulator, nrArgs);
+  for (int i = 0; i < nrArgs; ++i)
+    appendVarint(accumulator, index - argIndices[i]);
+  return visited.insert(dagNode);
+}
+
+static inline size_t
+readVarint(const unsigned char*& p)
+{
+  size_t value = 0;
+  int shift = 0;
+  for (;;)
+    {
+      unsigned char c = *p++;
+      value |= static_cast<size_t>(c & 0x7f) << shift;
+      if (c < 0x80)
+	return value;
+      shift += 7;
+    }
+}
+
+DagNode*
+MixfixModule::deserializeBinary(const char* encoding, size_t length)
+{
+  //
+  //	We decode in place so that the encoding can be read directly from
+  //	wherever it was received, such as memory shared with another process.
+  //
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(encoding);
+  const unsigned char* end = p + length;
+
+  Vector<DagNode*> history;
+  Vector<DagNode*> argList;
+  string name;
+  while (p < end)
+    {
+      int tag = *p++;
+      int index = history.size();
+      if (tag == BINARY_EAGER_SORT_TEST || tag == BINARY_LAZY_SORT_TEST)
+	{
+	  Sort* sort = getSorts()[readVarint(p)];
+	  Symbol* symbol = instantiateSortTest(sort, tag == BINARY_EAGER_SORT_TEST);
+	  argList.resize(1);
+	  argList[0] = history[index - readVarint(p)];
+	  history.append(symbol->makeDagNode(argList));
+	  continue;
+	}
+      if (tag == BINARY_VARIABLE)
+	{
+	  Sort* sort = getSorts()[readVarint(p)];
+	  VariableSymbol* symbol = safeCast(VariableSymbol*, instantiateVariable(sort));
+	  size_t nameLength = readVarint(p);
+	  name.assign(reinterpret_cast<const char*>(p), nameLength);
+	  p += nameLength;
+	  history.append(new VariableDagNode(symbol, Token::encode(name.c_str()), NONE));
+	  continue;
+	}
+
+      Symbol* symbol;
+      if (tag == BINARY_POLYMORPH)
+	{
+	  int polymorphIndex = readVarint(p);
+	  int kindIndex = readVarint(p);
+	  symbol = instantiatePolymorph(polymorphIndex, kindIndex);
+	}
+      else
+	{
+	  Assert(tag == BINARY_REGULAR, "bad tag " << tag);
+	  symbol = getSymbols()[readVarint(p)];
+	}
+      SymbolType type = getSymbolType(symbol);
+
+      mpz_class number;
+      if (type.hasFlag(SymbolType::ITER))
+	{
+	  size_t nrBytes = readVarint(p);
+	  mpz_import(number.get_mpz_t(), nrBytes, 1, 1, 1, 0, p);
+	  p += nrBytes;
+	}
+
+      DagNode* d = 0;
+      switch (type.getBasicType())
+	{
+	case SymbolType::FLOAT:
+	  {
+	    double value;
+	    memcpy(&value, p, sizeof(value));
+	    p += sizeof(value);
+	    d = new FloatDagNode(safeCast(FloatSymbol*, symbol), value);
+	    break;
+	  }
+	case SymbolType::STRING:
+	  {
+	    size_t valueLength = readVarint(p);
+	    Rope value(reinterpret_cast<const char*>(p), valueLength);
+	    p += valueLength;
+	    d = new StringDagNode(safeCast(StringSymbol*, symbol), value);
+	    break;
+	  }
+	case SymbolType::QUOTED_IDENTIFIER:
+	  {
+	    size_t nameLength = readVarint(p);
+	    name.assign(reinterpret_cast<const char*>(p), nameLength);
+	    p += nameLength;
+	    d = new QuotedIdentifierDagNode(safeCast(QuotedIdentifierSymbol*, symbol),
+					    Token::encode(name.c_str()));
+	    break;
+	  }
+	case SymbolType::SMT_NUMBER_SYMBOL:
+	  {
+	    size_t textLength = readVarint(p);
+	    name.assign(reinterpret_cast<const char*>(p), textLength);
+	    p += textLength;
+	    d = new SMT_NumberDagNode(safeCast(SMT_NumberSymbol*, symbol), mpq_class(name));
+	    break;
+	  }
+	}
+
+      int nrArgs = readVarint(p);
+      argList.resize(nrArgs);
+      for (int i = 0; i < nrArgs; ++i)
+	argList[i] = history[index - readVarint(p)];
+      if (d == 0)
+	{
+	  d = type.hasFlag(SymbolType::ITER) ?
+	    new S_DagNode(safeCast(S_Symbol*, symbol), number, argList[0]) :
+	    symbol->makeDagNode(argList);
+	}
+      history.append(d);
+    }
+  Assert(p == end, "overran binary encoding");
+  return history[history.size() - 1];
+}
@@ -29,7 +29,7 @@ SyntacticPreModule::loseFocus(bool clearCaches)
 {
   if (flatModule != 0)
     {
-      flatModule->clearMemo();
+      flatModule->unloadMemoCache();
       if (clearCaches)
 	flatModule->reset();
       flatModule->economize();
@@ -450,6 +450,12 @@ command		:	KW_SELECT		{ lexBubble(END_COMMAND, 1); }
 			  if (interpreter.setCurrentModule(lexerBubble))
 			    interpreter.showProfile();
 			}
+		|	KW_SHOW KW_JSON KW_PROFILE	{ lexBubble(END_COMMAND, 0); }
+			endBubble
+			{
+			  if (interpreter.setCurrentModule(lexerBubble))
+			    interpreter.showProfileJson();
+			}
 /*
  *	Commands to set interpreter state variables.
  */
@@ -1,5 +1,5 @@
 
-#line 2 "<stdout>"
+#line 3 "<stdout>"
 
 #define  YY_INT_ALIGNED short int
 
@@ -825,6 +825,7 @@ char *yytext;
 
 static void
 getInputFromRope(char* buf, yy_size_t& result, yy_size_t max_size);
+static bool inRange(int index, int size);
 static DagNode* makeDagNode(MixfixModule* m);
 static DagNode* makeVariableDagNode(MixfixModule* m, int code);
 static DagNode* makeQuotedIdentifierDagNode(MixfixModule* m, int code);
@@ -838,7 +839,20 @@ static DagNode* makeSMT_NumberDagNode(MixfixModule* m, const char* stringRep);
 //	gets called because we always pass back an EOT charater from YY_INPUT
 //	to avoid flex EOF handling.
 //
-#define YY_DECL DagNode* deserializeRope(MixfixModule* m, const Rope& argumentRope)
+#define YY_DECL DagNode* deserializeRope(MixfixModule* m, const Rope& argumentRope, bool checked)
+
+//
+//	A malformed encoding is an internal error unless our caller asked us to
+//	check the encoding, in which case we discard the rest of the input and
+//	return 0.
+//
+#define BAD_ENCODING(message) \
+  { if (!checked) CantHappen(message); BEGIN(INITIAL); YY_FLUSH_BUFFER; return 0; }
+
+//
+//	The default rule can only match a newline inside an argument list.
+//
+#define ECHO BAD_ENCODING("newline in arg")
 
 //
 //	We use safeResult to ensure a reference yy_size_t& can be passed to outlined code.
@@ -850,6 +864,7 @@ static Vector<DagNode*> argList;
 static int savedIndex;
 static int savedKindIndex;
 static mpz_class savedBigNum;
+static bool seenBigNum;
 static Vector<DagNode*> history;
 static Rope inputRope;
 static Rope::const_iterator current;
@@ -864,9 +879,9 @@ enum OpType
   };
 
 OpType opType;
-#line 867 "<stdout>"
+#line 883 "<stdout>"
 
-#line 869 "<stdout>"
+#line 885 "<stdout>"
 
 #define INITIAL 0
 #define SEEN_NUMBER_MODE 1
@@ -1085,9 +1100,9 @@ YY_DECL
 		}
 
 	{
-#line 107 "../../../src/Mixfix/deserializer.ll"
+#line 124 "../../../src/Mixfix/deserializer.ll"
 
-#line 109 "../../../src/Mixfix/deserializer.ll"
+#line 125 "../../../src/Mixfix/deserializer.ll"
 	argList.clear();
 	history.clear();
 	inputRope = argumentRope;
@@ -1095,7 +1110,7 @@ YY_DECL
 	endOfRope = false;
 
 
-#line 1098 "<stdout>"
+#line 1114 "<stdout>"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1154,38 +1169,43 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 117 "../../../src/Mixfix/deserializer.ll"
+#line 133 "../../../src/Mixfix/deserializer.ll"
 {
 						  savedIndex = atoi(yytext);
 						  opType = REGULAR;
+						  seenBigNum = false;
 						  BEGIN(SEEN_NUMBER_MODE);
 						}
 	YY_BREAK
 case 2:
 YY_RULE_SETUP
-#line 122 "../../../src/Mixfix/deserializer.ll"
+#line 139 "../../../src/Mixfix/deserializer.ll"
 {
 						  if (endOfRope)
-						    return history[history.size() - 1];
+						    {
+						      if (history.empty())
+							BAD_ENCODING("empty encoding");
+						      return history[history.size() - 1];
+						    }
 						}
 	YY_BREAK
 case 3:
 /* rule 3 can match eol */
 YY_RULE_SETUP
-#line 126 "../../../src/Mixfix/deserializer.ll"
+#line 147 "../../../src/Mixfix/deserializer.ll"
 ;
 	YY_BREAK
 case 4:
 /* rule 4 can match eol */
 YY_RULE_SETUP
-#line 127 "../../../src/Mixfix/deserializer.ll"
-CantHappen(((int) *yytext) << " in init");
+#line 148 "../../../src/Mixfix/deserializer.ll"
+BAD_ENCODING(((int) *yytext) << " in init");
 	YY_BREAK
 
 
 case 5:
 YY_RULE_SETUP
-#line 131 "../../../src/Mixfix/deserializer.ll"
+#line 152 "../../../src/Mixfix/deserializer.ll"
 {
 						  BEGIN(ARG_LIST_MODE);
 						}
@@ -1193,74 +1213,89 @@ YY_RULE_SETUP
 case 6:
 /* rule 6 can match eol */
 YY_RULE_SETUP
-#line 134 "../../../src/Mixfix/deserializer.ll"
+#line 155 "../../../src/Mixfix/deserializer.ll"
 {
 						  DagNode* d = makeDagNode(m);
+						  if (d == 0)
+						    BAD_ENCODING("bad operator " << savedIndex);
 						  history.append(d);
 						  BEGIN(INITIAL);
 						}
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 139 "../../../src/Mixfix/deserializer.ll"
+#line 162 "../../../src/Mixfix/deserializer.ll"
 {
 						  savedBigNum = yytext + 1;
+						  seenBigNum = true;
 						}
 	YY_BREAK
 case 8:
 /* rule 8 can match eol */
 YY_RULE_SETUP
-#line 142 "../../../src/Mixfix/deserializer.ll"
+#line 166 "../../../src/Mixfix/deserializer.ll"
 {
-						  history.append(makeStringDagNode(m, yytext));
+						  DagNode* d = makeStringDagNode(m, yytext);
+						  if (d == 0)
+						    BAD_ENCODING("bad string symbol " << savedIndex);
+						  history.append(d);
 						  BEGIN(INITIAL);
 						}
 	YY_BREAK
 case 9:
 /* rule 9 can match eol */
 YY_RULE_SETUP
-#line 146 "../../../src/Mixfix/deserializer.ll"
+#line 173 "../../../src/Mixfix/deserializer.ll"
 {
 						  int code = Token::encode(yytext + 1);
-						  history.append(makeVariableDagNode(m, code));
+						  DagNode* d = makeVariableDagNode(m, code);
+						  if (d == 0)
+						    BAD_ENCODING("bad variable sort " << savedIndex);
+						  history.append(d);
 						  BEGIN(INITIAL);
 						}
 	YY_BREAK
 case 10:
 /* rule 10 can match eol */
 YY_RULE_SETUP
-#line 151 "../../../src/Mixfix/deserializer.ll"
+#line 181 "../../../src/Mixfix/deserializer.ll"
 {
 						  int code = Token::encode(yytext + 1);
-						  history.append(makeQuotedIdentifierDagNode(m, code));
+						  DagNode* d = makeQuotedIdentifierDagNode(m, code);
+						  if (d == 0)
+						    BAD_ENCODING("bad quoted identifier symbol " << savedIndex);
+						  history.append(d);
 						  BEGIN(INITIAL);
 						}
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 156 "../../../src/Mixfix/deserializer.ll"
+#line 189 "../../../src/Mixfix/deserializer.ll"
 {
-						  history.append(makeFloatDagNode(m, yytext + 1));
+						  DagNode* d = makeFloatDagNode(m, yytext + 1);
+						  if (d == 0)
+						    BAD_ENCODING("bad float symbol " << savedIndex);
+						  history.append(d);
 						  BEGIN(INITIAL);
 						}
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 160 "../../../src/Mixfix/deserializer.ll"
+#line 196 "../../../src/Mixfix/deserializer.ll"
 {
 						  opType = EAGER_SORT_TEST;
 						}
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 163 "../../../src/Mixfix/deserializer.ll"
+#line 199 "../../../src/Mixfix/deserializer.ll"
 {
 						  opType = LAZY_SORT_TEST;
 						}
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 166 "../../../src/Mixfix/deserializer.ll"
+#line 202 "../../../src/Mixfix/deserializer.ll"
 {
 						  savedKindIndex = atoi(yytext + 1);
 						  opType = POLYMORPH;
@@ -1268,54 +1303,62 @@ YY_RULE_SETUP
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 170 "../../../src/Mixfix/deserializer.ll"
+#line 206 "../../../src/Mixfix/deserializer.ll"
 {
-						  history.append(makeSMT_NumberDagNode(m, yytext + 1));
+						  DagNode* d = makeSMT_NumberDagNode(m, yytext + 1);
+						  if (d == 0)
+						    BAD_ENCODING("bad SMT number symbol " << savedIndex);
+						  history.append(d);
 						  BEGIN(INITIAL);
 						}
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 174 "../../../src/Mixfix/deserializer.ll"
-CantHappen(((int) *yytext) << " in num");
+#line 213 "../../../src/Mixfix/deserializer.ll"
+BAD_ENCODING(((int) *yytext) << " in num");
 	YY_BREAK
 
 
 case 17:
 YY_RULE_SETUP
-#line 178 "../../../src/Mixfix/deserializer.ll"
+#line 217 "../../../src/Mixfix/deserializer.ll"
 {
 						  int historyIndex = atoi(yytext);
+						  if (!inRange(historyIndex, history.size()))
+						    BAD_ENCODING("bad back reference " << historyIndex);
 						  argList.append(history[historyIndex]);
 						}
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 182 "../../../src/Mixfix/deserializer.ll"
+#line 223 "../../../src/Mixfix/deserializer.ll"
 ;
 	YY_BREAK
 case 19:
 /* rule 19 can match eol */
 YY_RULE_SETUP
-#line 183 "../../../src/Mixfix/deserializer.ll"
+#line 224 "../../../src/Mixfix/deserializer.ll"
 {
-						  history.append(makeDagNode(m));
+						  DagNode* d = makeDagNode(m);
+						  if (d == 0)
+						    BAD_ENCODING("bad operator " << savedIndex);
+						  history.append(d);
 						  argList.clear();
 						  BEGIN(INITIAL);
 						}
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 188 "../../../src/Mixfix/deserializer.ll"
-CantHappen(((int) *yytext) << " in arg");
+#line 232 "../../../src/Mixfix/deserializer.ll"
+BAD_ENCODING(((int) *yytext) << " in arg");
 	YY_BREAK
 
 case 21:
 YY_RULE_SETUP
-#line 192 "../../../src/Mixfix/deserializer.ll"
+#line 236 "../../../src/Mixfix/deserializer.ll"
 ECHO;
 	YY_BREAK
-#line 1318 "<stdout>"
+#line 1362 "<stdout>"
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(SEEN_NUMBER_MODE):
 case YY_STATE_EOF(ARG_LIST_MODE):
@@ -2322,7 +2365,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 192 "../../../src/Mixfix/deserializer.ll"
+#line 236 "../../../src/Mixfix/deserializer.ll"
 
 
 #include "deserializerAux.cc"
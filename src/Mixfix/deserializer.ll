@@ -45,6 +45,7 @@
 
 static void
 getInputFromRope(char* buf, yy_size_t& result, yy_size_t max_size);
+static bool inRange(int index, int size);
 static DagNode* makeDagNode(MixfixModule* m);
 static DagNode* makeVariableDagNode(MixfixModule* m, int code);
 static DagNode* makeQuotedIdentifierDagNode(MixfixModule* m, int code);
@@ -58,7 +59,20 @@ static DagNode* makeSMT_NumberDagNode(MixfixModule* m, const char* stringRep);
 //	gets called because we always pass back an EOT charater from YY_INPUT
 //	to avoid flex EOF handling.
 //
-#define YY_DECL DagNode* deserializeRope(MixfixModule* m, const Rope& argumentRope)
+#define YY_DECL DagNode* deserializeRope(MixfixModule* m, const Rope& argumentRope, bool checked)
+
+//
+//	A malformed encoding is an internal error unless our caller asked us to
+//	check the encoding, in which case we discard the rest of the input and
+//	return 0.
+//
+#define BAD_ENCODING(message) \
+  { if (!checked) CantHappen(message); BEGIN(INITIAL); YY_FLUSH_BUFFER; return 0; }
+
+//
+//	The default rule can only match a newline inside an argument list.
+//
+#define ECHO BAD_ENCODING("newline in arg")
 
 //
 //	We use safeResult to ensure a reference yy_size_t& can be passed to outlined code.
@@ -70,6 +84,7 @@ static Vector<DagNode*> argList;
 static int savedIndex;
 static int savedKindIndex;
 static mpz_class savedBigNum;
+static bool seenBigNum;
 static Vector<DagNode*> history;
 static Rope inputRope;
 static Rope::const_iterator current;
@@ -118,14 +133,19 @@ ratNumber	({anyInt}|{posRat}|(-{posRat}))
 {natNumber}					{
 						  savedIndex = atoi(yytext);
 						  opType = REGULAR;
+						  seenBigNum = false;
 						  BEGIN(SEEN_NUMBER_MODE);
 						}
 \004						{
 						  if (endOfRope)
-						    return history[history.size() - 1];
+						    {
+						      if (history.empty())
+							BAD_ENCODING("empty encoding");
+						      return history[history.size() - 1];
+						    }
 						}
 \n						;
-[^\004]						CantHappen(((int) *yytext) << " in init");
+[^\004]						BAD_ENCODING(((int) *yytext) << " in init");
 }
 
 <SEEN_NUMBER_MODE>{
@@ -134,28 +154,43 @@ ratNumber	({anyInt}|{posRat}|(-{posRat}))
 						}
 \n						{
 						  DagNode* d = makeDagNode(m);
+						  if (d == 0)
+						    BAD_ENCODING("bad operator " << savedIndex);
 						  history.append(d);
 						  BEGIN(INITIAL);
 						}
 \^{posInt}					{
 						  savedBigNum = yytext + 1;
+						  seenBigNum = true;
 						}
 {string}					{
-						  history.append(makeStringDagNode(m, yytext));
+						  DagNode* d = makeStringDagNode(m, yytext);
+						  if (d == 0)
+						    BAD_ENCODING("bad string symbol " << savedIndex);
+						  history.append(d);
 						  BEGIN(INITIAL);
 						}
 v{maudeId}					{
 						  int code = Token::encode(yytext + 1);
-						  history.append(makeVariableDagNode(m, code));
+						  DagNode* d = makeVariableDagNode(m, code);
+						  if (d == 0)
+						    BAD_ENCODING("bad variable sort " << savedIndex);
+						  history.append(d);
 						  BEGIN(INITIAL);
 						}
 \'|\'{maudeId}					{
 						  int code = Token::encode(yytext + 1);
-						  history.append(makeQuotedIdentifierDagNode(m, code));
+						  DagNode* d = makeQuotedIdentifierDagNode(m, code);
+						  if (d == 0)
+						    BAD_ENCODING("bad quoted identifier symbol " << savedIndex);
+						  history.append(d);
 						  BEGIN(INITIAL);
 						}
 f{anyInt}					{
-						  history.append(makeFloatDagNode(m, yytext + 1));
+						  DagNode* d = makeFloatDagNode(m, yytext + 1);
+						  if (d == 0)
+						    BAD_ENCODING("bad float symbol " << savedIndex);
+						  history.append(d);
 						  BEGIN(INITIAL);
 						}
 s						{
@@ -169,24 +204,32 @@ p{natNumber}					{
 						  opType = POLYMORPH;
 						}
 q{ratNumber}					{
-						  history.append(makeSMT_NumberDagNode(m, yytext + 1));
+						  DagNode* d = makeSMT_NumberDagNode(m, yytext + 1);
+						  if (d == 0)
+						    BAD_ENCODING("bad SMT number symbol " << savedIndex);
+						  history.append(d);
 						  BEGIN(INITIAL);
 						}
-.						CantHappen(((int) *yytext) << " in num");
+.						BAD_ENCODING(((int) *yytext) << " in num");
 }
 
 <ARG_LIST_MODE>{
 {natNumber}					{
 						  int historyIndex = atoi(yytext);
+						  if (!inRange(historyIndex, history.size()))
+						    BAD_ENCODING("bad back reference " << historyIndex);
 						  argList.append(history[historyIndex]);
 						}
 ,						;
 \)\n						{
-						  history.append(makeDagNode(m));
+						  DagNode* d = makeDagNode(m);
+						  if (d == 0)
+						    BAD_ENCODING("bad operator " << savedIndex);
+						  history.append(d);
 						  argList.clear();
 						  BEGIN(INITIAL);
 						}
-.						CantHappen(((int) *yytext) << " in arg");
+.						BAD_ENCODING(((int) *yytext) << " in arg");
 	
 }
 
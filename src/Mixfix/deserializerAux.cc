@@ -52,34 +52,80 @@ getInputFromRope(char* buf, yy_size_t& result, yy_size_t max_size)
     }
 }
 
+static bool
+inRange(int index, int size)
+{
+  return index >= 0 && index < size;
+}
+
 static DagNode*
 makeDagNode(MixfixModule* m)
 {
+  //
+  //	We return 0 if the encoding doesn't make sense for this module, rather
+  //	than build a dag that might crash us later.
+  //
   Symbol* symbol;
   if (opType == EAGER_SORT_TEST || opType == LAZY_SORT_TEST)
     {
+      if (!inRange(savedIndex, m->getSorts().size()))
+	return 0;
       Sort* sort = m->getSorts()[savedIndex];
       symbol = m->instantiateSortTest(sort, opType == EAGER_SORT_TEST);
     }
+  else if (opType == POLYMORPH)
+    {
+      if (!inRange(savedIndex, m->getNrPolymorphs()) ||
+	  !inRange(savedKindIndex, m->getConnectedComponents().size()))
+	return 0;
+      symbol = m->instantiatePolymorph(savedIndex, savedKindIndex);
+    }
   else
     {
-      symbol = (opType == POLYMORPH) ?
-	m->instantiatePolymorph(savedIndex, savedKindIndex) :
-	m->getSymbols()[savedIndex];
-      SymbolType type = m->getSymbolType(symbol);
-      //cout << "symbolType " << type << endl;
-      if (type.hasFlag(SymbolType::ITER))
-	{
-	  S_Symbol* s = safeCast(S_Symbol*, symbol);
-	  return new S_DagNode(s, savedBigNum, argList[0]);
-	}
+      if (!inRange(savedIndex, m->getSymbols().size()))
+	return 0;
+      symbol = m->getSymbols()[savedIndex];
+    }
+  SymbolType type = m->getSymbolType(symbol);
+  switch (type.getBasicType())
+    {
+    case SymbolType::VARIABLE:
+    case SymbolType::FLOAT:
+    case SymbolType::STRING:
+    case SymbolType::QUOTED_IDENTIFIER:
+    case SymbolType::SMT_NUMBER_SYMBOL:
+      return 0;  // these have their own encodings
+    case SymbolType::SORT_TEST:
+      {
+	if (opType != EAGER_SORT_TEST && opType != LAZY_SORT_TEST)
+	  return 0;
+	break;
+      }
+    }
+  //
+  //	Flattened associative operators can have more arguments than their arity.
+  //
+  int nrArgs = argList.size();
+  int arity = symbol->arity();
+  if (type.hasFlag(SymbolType::ASSOC) ? nrArgs < arity : nrArgs != arity)
+    return 0;
+  if (type.hasFlag(SymbolType::ITER))
+    {
+      if (!seenBigNum)
+	return 0;
+      S_Symbol* s = safeCast(S_Symbol*, symbol);
+      return new S_DagNode(s, savedBigNum, argList[0]);
     }
+  if (seenBigNum)
+    return 0;
   return symbol->makeDagNode(argList);
 }
 
 static DagNode*
 makeVariableDagNode(MixfixModule* m, int code)
 {
+  if (!inRange(savedIndex, m->getSorts().size()))
+    return 0;
   Sort* sort = m->getSorts()[savedIndex];
   VariableSymbol* symbol = safeCast(VariableSymbol*, m->instantiateVariable(sort));
   return new VariableDagNode(symbol, code, NONE);
@@ -88,24 +134,29 @@ makeVariableDagNode(MixfixModule* m, int code)
 static DagNode*
 makeQuotedIdentifierDagNode(MixfixModule* m, int code)
 {
-  Symbol* symbol = m->getSymbols()[savedIndex];
-  QuotedIdentifierSymbol* s = safeCast(QuotedIdentifierSymbol*, symbol);
-  return new QuotedIdentifierDagNode(s, code);
+  if (!inRange(savedIndex, m->getSymbols().size()))
+    return 0;
+  QuotedIdentifierSymbol* s = dynamic_cast<QuotedIdentifierSymbol*>(m->getSymbols()[savedIndex]);
+  return (s == 0) ? 0 : new QuotedIdentifierDagNode(s, code);
 }
 
 static DagNode*
 makeStringDagNode(MixfixModule* m, const char* quotedString)
 {
-  Symbol* symbol = m->getSymbols()[savedIndex];
-  StringSymbol* s = safeCast(StringSymbol*, symbol);
-  return new StringDagNode(s, Token::stringToRope(quotedString));
+  if (!inRange(savedIndex, m->getSymbols().size()))
+    return 0;
+  StringSymbol* s = dynamic_cast<StringSymbol*>(m->getSymbols()[savedIndex]);
+  return (s == 0) ? 0 : new StringDagNode(s, Token::stringToRope(quotedString));
 }
 
 static DagNode*
 makeFloatDagNode(MixfixModule* m, const char* bitsAsInt64)
 {
-  Symbol* symbol = m->getSymbols()[savedIndex];
-  FloatSymbol* s = safeCast(FloatSymbol*, symbol);
+  if (!inRange(savedIndex, m->getSymbols().size()))
+    return 0;
+  FloatSymbol* s = dynamic_cast<FloatSymbol*>(m->getSymbols()[savedIndex]);
+  if (s == 0)
+    return 0;
 
   bool error;
   Int64 dBits = stringToInt64(bitsAsInt64, error);
@@ -118,8 +169,11 @@ makeFloatDagNode(MixfixModule* m, const char* bitsAsInt64)
 static DagNode*
 makeSMT_NumberDagNode(MixfixModule* m, const char* stringRep)
 {
-  Symbol* symbol = m->getSymbols()[savedIndex];
-  SMT_NumberSymbol* s = safeCast(SMT_NumberSymbol*, symbol);
+  if (!inRange(savedIndex, m->getSymbols().size()))
+    return 0;
+  SMT_NumberSymbol* s = dynamic_cast<SMT_NumberSymbol*>(m->getSymbols()[savedIndex]);
+  if (s == 0)
+    return 0;
   mpq_class value(stringRep);
   return new SMT_NumberDagNode(s, value);
 }
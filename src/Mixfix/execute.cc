@@ -67,6 +67,8 @@ Interpreter::startUsingModule(VisibleModule* module)
   UserLevelRewritingContext::clearTrialCount();
   if (getFlag(AUTO_CLEAR_MEMO))
     module->clearMemo();
+  else
+    module->loadMemoCache();  // in case it was saved and cleared when module lost focus
   if (getFlag(AUTO_CLEAR_PROFILE))
     module->clearProfile();
   module->protect();
@@ -119,15 +121,16 @@ Interpreter::printStats(const Timer& timer, RewritingContext& context)
   Int64 nrRewrites = context.getTotalCount();
   cout << "rewrites: " << nrRewrites;
 
-  Int64 real;
-  Int64 virt;
-  Int64 prof;
+  Int64 real = 0;
+  Int64 virt = 0;
+  Int64 prof = 0;
   if (showTiming)
     {
       showTiming = timer.getTimes(real, virt, prof);
       if (showTiming)
 	printTiming(nrRewrites, prof, real);
     }
+  recordStats(context, prof, real, showTiming);
 
   cout << '\n';
   if (getFlag(SHOW_BREAKDOWN))
@@ -148,11 +151,13 @@ Interpreter::printStats(const Timer& timer, RewritingContext& context, bool timi
 {
   Int64 nrRewrites = context.getTotalCount();
   cout << "rewrites: " << nrRewrites;
-  Int64 real;
-  Int64 virt;
-  Int64 prof;
-  if (timingFlag && timer.getTimes(real, virt, prof))
+  Int64 real = 0;
+  Int64 virt = 0;
+  Int64 prof = 0;
+  bool showTiming = timingFlag && timer.getTimes(real, virt, prof);
+  if (showTiming)
     printTiming(nrRewrites, prof, real);
+  recordStats(context, prof, real, showTiming);
   cout << '\n';
   if (getFlag(SHOW_BREAKDOWN))
     {
@@ -177,6 +182,7 @@ Interpreter::printStats(RewritingContext& context,
   cout << "rewrites: " << nrRewrites;
   if (timingFlag)
     printTiming(nrRewrites, cpuTime, realTime);
+  recordStats(context, cpuTime, realTime, timingFlag);
   cout << '\n';
   if (getFlag(SHOW_BREAKDOWN))
     {
@@ -188,6 +194,21 @@ Interpreter::printStats(RewritingContext& context,
     }
 }
 
+void
+Interpreter::recordStats(RewritingContext& context, Int64 cpuTime, Int64 realTime, bool timingFlag)
+{
+  haveLastStats = true;
+  lastTimingFlag = timingFlag;
+  lastNrRewrites = context.getTotalCount();
+  lastMbCount = context.getMbCount();
+  lastEqCount = context.getEqCount();
+  lastRlCount = context.getRlCount();
+  lastVariantNarrowingCount = context.getVariantNarrowingCount();
+  lastNarrowingCount = context.getNarrowingCount();
+  lastCpuTime = cpuTime;
+  lastRealTime = realTime;
+}
+
 void
 Interpreter::endRewriting(Timer& timer,
 			  CacheableRewritingContext* context,
@@ -404,7 +404,10 @@ UserLevelRewritingContext::commandLoop()
 		//
 		//	This is the only normal exit() that can be taken.
 		//
+		interpreter.saveMemoCaches();
 		MemoryCell::maybeShowResources();
+		if (MemoryCell::getShowResources())
+		  MetaModuleCache::showStatistics(cout);
 		cout << "Bye.\n";
 		interpreter.endXmlLog();
 		interpreter.endLatexLog();
@@ -434,6 +437,7 @@ UserLevelRewritingContext::beginCommand()
   if (!interactiveFlag)
     cout << "==========================================\n";
   rewriteCountAtLastInterrupt = -1;
+  ProfileModule::resetTimeBase();
 }
 
 void
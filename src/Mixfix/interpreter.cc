@@ -25,6 +25,7 @@
 //
 
 //      utility stuff
+#include <sys/resource.h>
 #include "macros.hh"
 #include "vector.hh"
 #include "tty.hh"
@@ -96,6 +97,7 @@ Interpreter::Interpreter()
   xmlLog = 0;
   xmlBuffer = 0;
   latexBuffer = 0;
+  haveLastStats = false;
 
   flags = DEFAULT_FLAGS;
   currentModule = 0;
@@ -159,6 +161,87 @@ void
 Interpreter::showProfile() const
 {
   currentModule->getFlatModule()->showProfile(cout);
+  if (!profileJsonFile.empty())
+    writeProfileJson();
+  if (!foldedStackFile.empty() && ProfileModule::getTimeProfiling())
+    writeFoldedStacks();
+}
+
+void
+Interpreter::showProfileJson() const
+{
+  printProfileJson(cout);
+}
+
+void
+Interpreter::writeProfileJson() const
+{
+  //
+  //	Overwrite the file each time so it always holds the latest profile
+  //	as a single JSON object.
+  //
+  ofstream out(profileJsonFile);
+  printProfileJson(out);
+  if (!out.flush())
+    IssueWarning("failed to write profile to " << QUOTE(profileJsonFile) << '.');
+}
+
+void
+Interpreter::printProfileJson(ostream& out) const
+{
+  out << "{\"module\": ";
+  ProfileModule::printJsonString(out, Token::name(currentModule->id()));
+  out << ",\n\"lastCommand\": ";
+  if (haveLastStats)
+    {
+      out << "{\"rewrites\": " << lastNrRewrites <<
+	", \"mbApplications\": " << lastMbCount <<
+	", \"equationalRewrites\": " << lastEqCount <<
+	", \"ruleRewrites\": " << lastRlCount <<
+	", \"variantNarrowingSteps\": " << lastVariantNarrowingCount <<
+	", \"narrowingSteps\": " << lastNarrowingCount;
+      if (lastTimingFlag)
+	out << ", \"cpuMs\": " << lastCpuTime / 1000.0 << ", \"realMs\": " << lastRealTime / 1000.0;
+      out << '}';
+    }
+  else
+    out << "null";
+  out << ",\n\"resources\": ";
+  showResourcesJson(out);
+  out << ",\n\"profile\": {";
+  currentModule->getFlatModule()->showProfileJson(out);
+  out << "}}\n";
+}
+
+void
+Interpreter::writeFoldedStacks() const
+{
+  ofstream out(foldedStackFile);
+  currentModule->getFlatModule()->showFoldedStacks(out);
+  if (!out.flush())
+    IssueWarning("failed to write folded stacks to " << QUOTE(foldedStackFile) << '.');
+}
+
+void
+Interpreter::showResourcesJson(ostream& s)
+{
+  s << '{';
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+      s << "\"userSeconds\": " << usage.ru_utime.tv_usec / 1000000.0 + usage.ru_utime.tv_sec <<
+	", \"systemSeconds\": " << usage.ru_stime.tv_usec / 1000000.0 + usage.ru_stime.tv_sec <<
+	", \"maxResidentBytes\": " << 1024 * static_cast<Int64>(usage.ru_maxrss) <<
+	", \"majorPageFaults\": " << usage.ru_majflt <<
+	", \"minorPageFaults\": " << usage.ru_minflt <<
+	", \"voluntaryContextSwitches\": " << usage.ru_nvcsw <<
+	", \"involuntaryContextSwitches\": " << usage.ru_nivcsw << ", ";
+    }
+  s << "\"garbageCollections\": " << MemoryCell::getGcCount() <<
+    ", \"arenas\": " << MemoryCell::getNrArenas() <<
+    ", \"nodes\": " << MemoryCell::getNrNodes() <<
+    ", \"bucketBytes\": " << MemoryCell::getBucketStorage() <<
+    ", \"bucketBytesInUse\": " << MemoryCell::getStorageInUse() << '}';
 }
 
 void
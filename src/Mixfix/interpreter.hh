@@ -148,6 +148,8 @@ public:
   void beginLatexLog(const char* fileName);
   void endLatexLog();
   MaudemlBuffer* getXmlBuffer() const;
+  void setProfileJsonFile(const char* fileName);
+  void setFoldedStackFile(const char* fileName);
 
   void cleanCaches();
   void setFlag(Flags flag, bool polarity);
@@ -209,6 +211,7 @@ public:
   bool excludedModule(int id);
 
   void showProfile() const;
+  void showProfileJson() const;
   void showKinds() const;
   void showSummary() const;
   void showSortsAndSubsorts() const;
@@ -235,6 +238,7 @@ private:
   static DagNode* makeDag(Term* subjectTerm);
   static void printTiming(Int64 nrRewrites, Int64 cpu, Int64 real);
   static void printBubble(ostream& s, const Vector<int>& bubble);
+  static void showResourcesJson(ostream& s);
 
   Argument* handleArgument(const ViewExpression* expr,
 		      EnclosingObject* enclosingObject,
@@ -251,6 +255,10 @@ private:
 		  int64_t realTime,
 		  bool timingFlag,
 		  int64_t nrStates = NONE);
+  void recordStats(RewritingContext& context, Int64 cpuTime, Int64 realTime, bool timingFlag);
+  void writeProfileJson() const;
+  void printProfileJson(ostream& s) const;
+  void writeFoldedStacks() const;
   void beginRewriting(bool debug);
   void endRewriting(Timer& timer,
 		    CacheableRewritingContext* context,
@@ -342,6 +350,22 @@ private:
   ofstream* xmlLog;
   MaudemlBuffer* xmlBuffer;
   MaudeLatexBuffer* latexBuffer;
+  //
+  //	Statistics from the last command that printed them, kept for
+  //	machine-readable profiles.
+  //
+  string profileJsonFile;
+  string foldedStackFile;
+  bool haveLastStats;
+  bool lastTimingFlag;
+  Int64 lastNrRewrites;
+  Int64 lastMbCount;
+  Int64 lastEqCount;
+  Int64 lastRlCount;
+  Int64 lastVariantNarrowingCount;
+  Int64 lastNarrowingCount;
+  Int64 lastCpuTime;
+  Int64 lastRealTime;
 
   int flags;
   //int printFlags;
@@ -404,6 +428,18 @@ Interpreter::getXmlBuffer() const
   return xmlBuffer;
 }
 
+inline void
+Interpreter::setProfileJsonFile(const char* fileName)
+{
+  profileJsonFile = fileName;
+}
+
+inline void
+Interpreter::setFoldedStackFile(const char* fileName)
+{
+  foldedStackFile = fileName;
+}
+
 inline bool
 Interpreter::getFlag(Flags flag) const
 {
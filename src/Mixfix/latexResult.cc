@@ -299,6 +299,7 @@ MaudeLatexBuffer::generateSearchGraph(const RewriteSequenceSearch* graph, bool s
   //
   const VisibleModule* m = safeCastNonNull<VisibleModule*>(graph->getStateDag(0)->symbol()->getModule());
   int nrStates = graph->getNrStates();
+  Vector<RewriteSequenceSearch::Arc> arcs;
   for (int i = 0; i < nrStates; ++i)
     {
       if (i != 0)
@@ -310,15 +311,18 @@ MaudeLatexBuffer::generateSearchGraph(const RewriteSequenceSearch* graph, bool s
       MixfixModule::latexPrintDagNode(output, d);
       output << "$\n";
       
+      graph->getSortedArcs(i, arcs);
+      int nrArcs = arcs.size();
       int arcNr = 0;
-      for (auto& j : graph->getStateFwdArcs(i))
+      for (int j = 0; j < nrArcs;)
 	{
+	  int nextState = arcs[j].nextState;
 	  output << "\\par$\\maudeResponse{arc}\\maudeSpace\\maudeNumber{" << arcNr <<
-	    "}\\maudeArcArrow\\maudeResponse{state}\\maudeSpace\\maudeNumber{" << j.first << "}$\n";
-	  for (Rule* k : j.second)
+	    "}\\maudeArcArrow\\maudeResponse{state}\\maudeSpace\\maudeNumber{" << nextState << "}$\n";
+	  for (; j < nrArcs && arcs[j].nextState == nextState; ++j)
 	    {
 	      output << "$\\maudeSpace\\maudeLeftParen";
-	      m->latexPrintRule(output, nullptr, k);
+	      m->latexPrintRule(output, nullptr, arcs[j].rule);
 	      output << "\\maudeRightParen$\n";
 	    }
 	  ++arcNr;
@@ -253,6 +253,7 @@ path					return KW_PATH;
 state|states				return KW_STATE;
 label|labels				return KW_LABEL;
 profile					return KW_PROFILE;
+json					return KW_JSON;
 number					return KW_NUMBER;
 rat|rational				return KW_RAT;
 test					return KW_TEST;
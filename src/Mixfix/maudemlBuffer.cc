@@ -644,6 +644,7 @@ MaudemlBuffer::generateSearchGraph(RewriteSequenceSearch* graph)
   //attributePair("id", "g1");
   attributePair("edgedefault", "directed");
   int nrStates = graph->getNrStates();
+  Vector<RewriteSequenceSearch::Arc> arcs;
   for (int i = 0; i < nrStates; i++)
     {
       beginElement("node");
@@ -654,20 +655,19 @@ MaudemlBuffer::generateSearchGraph(RewriteSequenceSearch* graph)
       endElement();
       endElement();
 
-      const RewriteSequenceSearch::ArcMap& fwdArcs =
-	graph->getStateFwdArcs(i);
-      for (RewriteSequenceSearch::ArcMap::const_iterator j = fwdArcs.begin();
-	   j != fwdArcs.end(); ++j)
+      graph->getSortedArcs(i, arcs);
+      int nrArcs = arcs.size();
+      for (int j = 0; j < nrArcs;)
 	{
+	  int nextState = arcs[j].nextState;
 	  beginElement("edge");
 	  attributePair("source", "n", i);
-	  attributePair("target", "n", (*j).first);
-	  const set<Rule*>& r = (*j).second;
-	  for (set<Rule*>::const_iterator k = r.begin(); k != r.end(); k++)
+	  attributePair("target", "n", nextState);
+	  for (; j < nrArcs && arcs[j].nextState == nextState; ++j)
 	    {
 	      beginElement("data");
 	      attributePair("key", "rule");
-	      generate(*k);
+	      generate(arcs[j].rule);
 	      endElement();
 	    }
 	  endElement();
@@ -0,0 +1,278 @@
+/*
+
+    This file is part of the Maude 3 interpreter.
+
+    Copyright 2026 SRI International, Menlo Park, CA 94025, USA.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.
+
+*/
+
+//
+//	Routines for saving a module's memo table to a file and reloading it
+//	in a later session.
+//
+//	Dags are stored in the format produced by MixfixModule::serialize(),
+//	which refers to symbols by their index within the module. It is
+//	therefore only meaningful for an identical module built by the same
+//	version of Maude, so a cache file is named by a fingerprint of the
+//	flattened module text and its header records the format revision and
+//	the Maude version. Any change to the module or anything it imports
+//	gives a different file.
+//
+//	Cache files are not trusted: every encoding is deserialized in the
+//	deserializer's checked mode, which rejects anything that doesn't make
+//	sense for the module, and every deserialized dag is checked to be well
+//	kinded before it goes in the memo map. Any problem causes the whole
+//	file to be ignored. Damage that leaves a well formed encoding, such as
+//	a changed number, can't be detected.
+//
+//	File format:
+//	  header line
+//	  number of entries
+//	  for each entry: from-dag length and to-dag length on one line
+//	  followed by the from-dag and to-dag encodings
+//
+
+static const char memoCacheHeader[] = "Maude memo cache";
+static const int memoCacheFormat = 2;  // bump when the file or dag encoding changes
+
+string VisibleModule::memoCacheDirectory;
+
+void
+VisibleModule::setMemoCacheDirectory(const char* directory)
+{
+  memoCacheDirectory = directory;
+}
+
+void
+VisibleModule::loadMemoCache()
+{
+  //
+  //	We only load the cache once, when the module is first compiled or
+  //	used, or after unloadMemoCache(); in particular not every time a
+  //	memo table that was flushed because of a size limit becomes empty.
+  //
+  if (memoCacheDirectory.empty() || memoCacheLoaded)
+    return;
+  memoCacheLoaded = true;
+  if (memoCacheFile.empty())
+    makeMemoCacheFileName();
+  if (hasMemoMap() && getMemoMap()->getNrEntries() > 0)
+    return;  // don't overwrite a memo table we already have
+
+  ifstream in(memoCacheFile);
+  if (!in)
+    return;  // nothing saved yet
+  string header;
+  int nrEntries;
+  if (!getline(in, header) || header != makeMemoCacheHeader() || !(in >> nrEntries))
+    {
+      IssueWarning("ignoring memo cache file " << QUOTE(memoCacheFile) <<
+		   " with bad header or from a different version of Maude.");
+      return;
+    }
+  //
+  //	Read every encoding before we change the memo table.
+  //
+  Vector<string> encodings;
+  for (int i = 0; i < nrEntries; ++i)
+    {
+      size_t fromLength;
+      size_t toLength;
+      string fromEncoding;
+      string toEncoding;
+      if (!(in >> fromLength >> toLength) || in.get() != '\n' ||
+	  !readDag(in, fromLength, fromEncoding) || !readDag(in, toLength, toEncoding))
+	{
+	  IssueWarning("ignoring memo cache file " << QUOTE(memoCacheFile) <<
+		       " since it is truncated or damaged.");
+	  return;
+	}
+      encodings.append(fromEncoding);
+      encodings.append(toEncoding);
+    }
+
+  MemoMap* memoMap = getMemoMap();
+  int nrEncodings = encodings.size();
+  for (int i = 0; i < nrEncodings; i += 2)
+    {
+      DagNode* fromDag = deserialize(encodings[i], true);
+      DagNode* toDag = (fromDag == 0) ? 0 : deserialize(encodings[i + 1], true);
+      if (toDag == 0)
+	{
+	  IssueWarning("ignoring memo cache file " << QUOTE(memoCacheFile) <<
+		       " since entry " << i / 2 + 1 << " is corrupt.");
+	  clearMemo();
+	  return;
+	}
+      //
+      //	Deserialized dags are vulnerable to the garbage collector so
+      //	they are kept as the roots of rewriting contexts.
+      //
+      RewritingContext fromContext(fromDag);
+      RewritingContext context(toDag);
+      PointerSet visited;
+      if (wellKinded(fromDag, visited) && wellKinded(toDag, visited) &&
+	  fromDag->symbol()->rangeComponent() == toDag->symbol()->rangeComponent())
+	{
+	  //
+	  //	A deserialized dag has no sort information and is not in
+	  //	theory normal form; in particular AC arguments come back with
+	  //	multiplicity 1 and in the order they were saved, which depends
+	  //	on symbol creation order in the saving session. The from-dag
+	  //	must be normalized so that it hashes and compares equal to a
+	  //	live subject; computing its true sort does this bottom-up
+	  //	without rewriting at the top. The to-dag is canonical in the
+	  //	memo map and must not change in place later, so we reduce it
+	  //	now; since it was a normal form when it was saved, this does no
+	  //	equational rewriting.
+	  //
+	  fromDag->computeTrueSort(fromContext);
+	  context.reduce();
+	  memoMap->assignToDag(memoMap->getFromIndex(fromDag), context.root());
+	  continue;
+	}
+      IssueWarning("ignoring memo cache file " << QUOTE(memoCacheFile) <<
+		   " since entry " << i / 2 + 1 << " is ill-kinded.");
+      clearMemo();
+      return;
+    }
+}
+
+void
+VisibleModule::unloadMemoCache()
+{
+  //
+  //	Save our memo table and discard it; if we are used again it will be
+  //	reloaded.
+  //
+  saveMemoCache();
+  clearMemo();
+  memoCacheLoaded = false;
+}
+
+string
+VisibleModule::makeMemoCacheHeader()
+{
+  ostringstream header;
+  header << memoCacheHeader << ' ' << memoCacheFormat << ' ' << PACKAGE_VERSION;
+  return header.str();
+}
+
+void
+VisibleModule::makeMemoCacheFileName()
+{
+  //
+  //	We compute the file name once, when the module is first used, so that
+  //	changes to print settings can't change the fingerprint before we save.
+  //	We use 64-bit FNV-1a since it is simple and stable across platforms.
+  //
+  ostringstream text;
+  showModule(text, true);
+  const string& t = text.str();
+  uint64_t fingerprint = 14695981039346656037ULL;
+  for (char c : t)
+    {
+      fingerprint ^= static_cast<unsigned char>(c);
+      fingerprint *= 1099511628211ULL;
+    }
+  ostringstream fileName;
+  fileName << memoCacheDirectory << '/';
+  for (const char* p = Token::name(id()); *p != '\0'; ++p)
+    fileName << (*p == '/' ? '_' : *p);
+  fileName << '-';
+  for (int shift = 60; shift >= 0; shift -= 4)
+    fileName << "0123456789abcdef"[(fingerprint >> shift) & 0xf];  // fixed width
+  fileName << ".memo";
+  memoCacheFile = fileName.str();
+}
+
+bool
+VisibleModule::readDag(istream& in, size_t length, string& buffer)
+{
+  buffer.resize(length);
+  return length > 0 && in.read(&buffer[0], length) && buffer[length - 1] == '\n';
+}
+
+void
+VisibleModule::saveMemoCache()
+{
+  if (memoCacheFile.empty() || !hasMemoMap())
+    return;
+  MemoMap* memoMap = getMemoMap();
+  Vector<Rope> encodings;
+  int nrEntries = memoMap->getNrEntries();
+  for (int i = 0; i < nrEntries; ++i)
+    {
+      DagNode* fromDag;
+      DagNode* toDag;
+      if (memoMap->getEntry(i, fromDag, toDag))
+	{
+	  encodings.append(serialize(fromDag));
+	  encodings.append(serialize(toDag));
+	}
+    }
+  if (encodings.empty())
+    return;
+  //
+  //	Write to a temporary file and rename it so that a concurrent session
+  //	never sees a partially written cache.
+  //
+  string tempFile = memoCacheFile + ".tmp";
+  int nrEncodings = encodings.size();
+  {
+    ofstream out(tempFile);
+    out << makeMemoCacheHeader() << '\n' << nrEncodings / 2 << '\n';
+    for (int i = 0; i < nrEncodings; i += 2)
+      {
+	out << encodings[i].length() << ' ' << encodings[i + 1].length() << '\n' <<
+	  encodings[i] << encodings[i + 1];
+      }
+    if (!out.flush())
+      {
+	IssueWarning("failed to write memo cache file " << QUOTE(tempFile) << '.');
+	return;
+      }
+  }
+  if (rename(tempFile.c_str(), memoCacheFile.c_str()) != 0)
+    IssueWarning("failed to rename memo cache file " << QUOTE(tempFile) << '.');
+}
+
+bool
+VisibleModule::wellKinded(DagNode* dagNode, PointerSet& visited)
+{
+  //
+  //	Check that each argument is in the kind its symbol expects, since
+  //	sort computations assume this.
+  //
+  if (visited.pointer2Index(dagNode) != NONE)
+    return true;
+  visited.insert(dagNode);
+  Symbol* symbol = dagNode->symbol();
+  int arity = symbol->arity();
+  int argNr = 0;
+  for (DagArgumentIterator a(*dagNode); a.valid(); a.next(), ++argNr)
+    {
+      DagNode* d = a.argument();
+      //
+      //	Flattened associative symbols can have more arguments than their arity.
+      //
+      const ConnectedComponent* expected = symbol->domainComponent(argNr < arity ? argNr : arity - 1);
+      if (d->symbol()->rangeComponent() != expected || !wellKinded(d, visited))
+	return false;
+    }
+  return true;
+}
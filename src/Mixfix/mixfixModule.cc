@@ -220,6 +220,7 @@ MixfixModule::nonTerminal(const Sort* sort, NonTerminalType type)
 #include "graphPrint.cc"
 #include "strategyPrint.cc"
 #include "serialize.cc"
+#include "binarySerialize.cc"
 
 MixfixModule::MixfixModule(int name, ModuleType moduleType)
   : ProfileModule(name),
@@ -334,7 +334,9 @@ public:
   Symbol* findSMT_Symbol(Term* term);
 
   Rope serialize(DagNode* dagNode);
-  DagNode* deserialize(const Rope& encoding);
+  DagNode* deserialize(const Rope& encoding, bool checked = false);
+  void serializeBinary(DagNode* dagNode, string& encoding);
+  DagNode* deserializeBinary(const char* encoding, size_t length);
 
   //
   //	This functionality is to enable statements to be transformed after they
@@ -813,6 +815,7 @@ private:
 				  const Vector<Sort*>& domainAndRange2);
 
   int visit(DagNode* dagNode, PointerSet& visited, Rope& accumulator);
+  int binaryVisit(DagNode* dagNode, PointerSet& visited, string& accumulator);
 
   bool ambiguous(int iflags) const;
   static bool rangeOfArgumentsKnown(int iflags, bool rangeKnown, bool rangeDisambiguated);
@@ -1274,11 +1277,15 @@ MixfixModule::canHaveAsParameter(ModuleType t1, ModuleType t2)
 }
 
 inline DagNode*
-MixfixModule::deserialize(const Rope& encoding)
+MixfixModule::deserialize(const Rope& encoding, bool checked)
 {
-  extern DagNode* deserializeRope(MixfixModule*, const Rope&);
+  //
+  //	If checked is true, an encoding that doesn't make sense for this
+  //	module gives 0 rather than an internal error.
+  //
+  extern DagNode* deserializeRope(MixfixModule*, const Rope&, bool);
   
-  return deserializeRope(this, encoding);
+  return deserializeRope(this, encoding, checked);
 }
 
 inline void
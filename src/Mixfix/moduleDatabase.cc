@@ -123,3 +123,10 @@ ModuleDatabase::latexShowNamedModules(ostream& s) const
       s << "\\maudeModule{" << Token::latexName(m->id()) << "}\n";
     }
 }
+
+void
+ModuleDatabase::saveMemoCaches() const
+{
+  for (const auto& p : moduleMap)
+    p.second->saveMemoCache();
+}
@@ -48,6 +48,7 @@ public:
   const ImportMap& getOoIncludes() const;
   void showNamedModules(ostream& s) const;
   void latexShowNamedModules(ostream& s) const;
+  void saveMemoCaches() const;
 
 private:
   typedef map<int, PreModule*> ModuleMap;
@@ -60,6 +60,7 @@ public:
   virtual const ModuleDatabase::ImportMap* getAutoImports() const = 0;
   virtual VisibleModule* getFlatSignature() = 0;
   virtual VisibleModule* getFlatModule() = 0;
+  virtual void saveMemoCache() = 0;
 
 private:
   struct Parameter
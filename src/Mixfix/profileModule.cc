@@ -25,6 +25,9 @@
 //
 
 //	utility stuff
+#include <time.h>
+#include <fstream>
+#include <sstream>
 #include "macros.hh"
 #include "vector.hh"
 
@@ -45,11 +48,16 @@
 #include "strategyDefinition.hh"
 
 //      front end class definitions
+#include "token.hh"
 #include "profileModule.hh"
 
+bool ProfileModule::timeProfiling = false;
+Int64 ProfileModule::lastTime = 0;
+
 ProfileModule::ProfileModule(int name)
   : Module(name)
 {
+  lastCharge = timeMap.end();
 }
 
 ProfileModule::SymbolProfile::SymbolProfile()
@@ -91,6 +99,8 @@ ProfileModule::clearProfile()
   eqInfo.clear();
   rlInfo.clear();
   sdInfo.clear();
+  timeMap.clear();
+  lastCharge = timeMap.end();
 }
 
 void
@@ -210,6 +220,149 @@ ProfileModule::profileSdConditionStart(const StrategyDefinition* sdef)
   ++(sdInfo[index].nrConditionStarts);
 }
 
+//////////////////////
+
+//
+//	Time profiling uses wall-clock intervals rather than sampling since
+//	the profiling interval timer belongs to class Timer. Each profiling
+//	event charges the time since the previous event to whatever it
+//	describes: a condition start is charged the time spent matching the lhs,
+//	a rewrite the time spent finding the redex and instantiating the rhs. The
+//	time is kept against the full stack of statements whose conditions we are
+//	solving so that it can be exported as folded stacks for flame graphs.
+//
+
+Int64
+ProfileModule::elapsedTime()
+{
+  timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  Int64 now = static_cast<Int64>(t.tv_sec) * 1000000000 + t.tv_nsec;
+  Int64 elapsed = (lastTime == 0) ? 0 : now - lastTime;
+  lastTime = now;
+  return elapsed;
+}
+
+void
+ProfileModule::profileTime(const Vector<const PreEquation*>& trials, const void* item, int type)
+{
+  Int64 elapsed = elapsedTime();
+  static FrameStack key;  // reused to avoid an allocation per event
+  key.clear();
+  for (int i = trials.size() - 1; i >= 0; --i)
+    key.push_back({trials[i], RewritingContext::NORMAL});
+  key.push_back({item, type});
+  //
+  //	Most events repeat a stack we've already seen, so we only copy key
+  //	into the map on a miss.
+  //
+  lastCharge = timeMap.find(key);
+  if (lastCharge == timeMap.end())
+    lastCharge = timeMap.insert(TimeMap::value_type(key, 0)).first;
+  lastCharge->second += elapsed;
+}
+
+void
+ProfileModule::profileTimeContinued()
+{
+  Int64 elapsed = elapsedTime();
+  if (lastCharge != timeMap.end())
+    lastCharge->second += elapsed;
+}
+
+void
+ProfileModule::showTime(ostream& s, const ItemTimeMap& itemTimes, const void* item, double totalTime)
+{
+  ItemTimeMap::const_iterator i = itemTimes.find(item);
+  if (i != itemTimes.end())
+    {
+      s << "\ttime: " << i->second / 1000000.0 << " ms (" <<
+	((100 * i->second) / totalTime) << "%)";
+    }
+}
+
+void
+ProfileModule::printFrame(ostream& s, const Frame& frame)
+{
+  switch (frame.type)
+    {
+    case RewritingContext::BUILTIN:
+      {
+	s << "built-in " << static_cast<const Symbol*>(frame.item);
+	break;
+      }
+    case RewritingContext::MEMOIZED:
+      {
+	s << "memo " << static_cast<const Symbol*>(frame.item);
+	break;
+      }
+    default:
+      {
+	const PreEquation* pe = static_cast<const PreEquation*>(frame.item);
+	if (dynamic_cast<const SortConstraint*>(pe) != 0)
+	  s << "mb";
+	else if (dynamic_cast<const Equation*>(pe) != 0)
+	  s << "eq";
+	else if (dynamic_cast<const Rule*>(pe) != 0)
+	  s << "rl";
+	else
+	  s << "sd";
+	int label = pe->getLabel().id();
+	if (label != NONE)
+	  s << " [" << Token::name(label) << ']';
+	else
+	  s << ' ' << static_cast<const LineNumber&>(*pe);
+	break;
+      }
+    }
+}
+
+void
+ProfileModule::printFoldedFrame(ostream& s, const string& name)
+{
+  //
+  //	Frame names come from symbols, labels and file names and so may
+  //	contain anything. A semicolon would split the frame and white space
+  //	could be taken as the separator before the count, so we replace them.
+  //
+  for (char c : name)
+    {
+      if (c == ';')
+	s << ':';
+      else if (isspace(static_cast<unsigned char>(c)))
+	s << '_';
+      else
+	s << c;
+    }
+}
+
+void
+ProfileModule::showFoldedStacks(ostream& out) const
+{
+  //
+  //	One line per distinct stack in the folded format understood by
+  //	flamegraph.pl: frames separated by semicolons, then a count, which is
+  //	microseconds for us.
+  //
+  for (const auto& p : timeMap)
+    {
+      Int64 microseconds = p.second / 1000;
+      if (microseconds == 0)
+	continue;
+      ostringstream name;
+      name << this;
+      printFoldedFrame(out, name.str());
+      for (const Frame& f : p.first)
+	{
+	  out << ';';
+	  name.str("");
+	  printFrame(name, f);
+	  printFoldedFrame(out, name.str());
+	}
+      out << ' ' << microseconds << '\n';
+    }
+}
+
 ////////////////////////
 
 void
@@ -291,6 +444,8 @@ ProfileModule::showProfile(ostream& s) const
       total += sdInfo[i].nrRewrites;
     floatTotal = total;
   }
+  ItemTimeMap itemTimes;
+  double totalTime = computeItemTimes(itemTimes);
   {
     const Vector<Symbol*>& symbols = getSymbols();
     int nrSymbols = symbolInfo.length();
@@ -319,6 +474,7 @@ ProfileModule::showProfile(ostream& s) const
 	      }
 	    if (p.nrMemoRewrites > 0)
 	      s << g << "memo rewrites: " << PC(p.nrMemoRewrites);
+	    showTime(s, itemTimes, symbols[i], totalTime);
 	    s << "\n\n";
 	  }
       }
@@ -333,14 +489,18 @@ ProfileModule::showProfile(ostream& s) const
 	  {
 	    s << mbs[i] << '\n';
 	    s << "lhs matches: " << p.nrConditionStarts <<
-	      "\trewrites: " << PC(p.nrRewrites) << '\n';
+	      "\trewrites: " << PC(p.nrRewrites);
+	    showTime(s, itemTimes, mbs[i], totalTime);
+	    s << '\n';
 	    showFragmentProfile(s, p.fragmentInfo, p.nrConditionStarts);
 	    s << '\n';
 	  }
 	else if (p.nrRewrites > 0)
 	  {
 	    s << mbs[i] << '\n';
-	    s << "rewrites: " << PC(p.nrRewrites) << "\n\n";
+	    s << "rewrites: " << PC(p.nrRewrites);
+	    showTime(s, itemTimes, mbs[i], totalTime);
+	    s << "\n\n";
 	  }
       }
   }
@@ -354,14 +514,18 @@ ProfileModule::showProfile(ostream& s) const
 	  {
 	    s << eqs[i] << '\n';
 	    s << "lhs matches: " << p.nrConditionStarts <<
-	      "\trewrites: " << PC(p.nrRewrites) << '\n';
+	      "\trewrites: " << PC(p.nrRewrites);
+	    showTime(s, itemTimes, eqs[i], totalTime);
+	    s << '\n';
 	    showFragmentProfile(s, p.fragmentInfo, p.nrConditionStarts);
 	    s << '\n';
 	  }
 	else if (p.nrRewrites > 0)
 	  {
 	    s << eqs[i] << '\n';
-	    s << "rewrites: " << PC(p.nrRewrites) << "\n\n";
+	    s << "rewrites: " << PC(p.nrRewrites);
+	    showTime(s, itemTimes, eqs[i], totalTime);
+	    s << "\n\n";
 	  }
       }
   }
@@ -375,14 +539,18 @@ ProfileModule::showProfile(ostream& s) const
 	  {
 	    s << rls[i] << '\n';
 	    s << "lhs matches: " << p.nrConditionStarts <<
-	      "\trewrites: " << PC(p.nrRewrites) << '\n';
+	      "\trewrites: " << PC(p.nrRewrites);
+	    showTime(s, itemTimes, rls[i], totalTime);
+	    s << '\n';
 	    showFragmentProfile(s, p.fragmentInfo, p.nrConditionStarts);
 	    s << '\n';
 	  }
 	else if (p.nrRewrites > 0)
 	  {
 	    s << rls[i] << '\n';
-	    s << "rewrites: " << PC(p.nrRewrites) << "\n\n";
+	    s << "rewrites: " << PC(p.nrRewrites);
+	    showTime(s, itemTimes, rls[i], totalTime);
+	    s << "\n\n";
 	  }
       }
   }
@@ -396,17 +564,216 @@ ProfileModule::showProfile(ostream& s) const
 	  {
 	    s << sdefs[i] << '\n';
 	    s << "lhs matches: " << p.nrConditionStarts <<
-	      "\trewrites: " << PC(p.nrRewrites) << '\n';
+	      "\trewrites: " << PC(p.nrRewrites);
+	    showTime(s, itemTimes, sdefs[i], totalTime);
+	    s << '\n';
 	    showFragmentProfile(s, p.fragmentInfo, p.nrConditionStarts);
 	    s << '\n';
 	  }
 	else if (p.nrRewrites > 0)
 	  {
 	    s << sdefs[i] << '\n';
-	    s << "rewrites: " << PC(p.nrRewrites) << "\n\n";
+	    s << "rewrites: " << PC(p.nrRewrites);
+	    showTime(s, itemTimes, sdefs[i], totalTime);
+	    s << "\n\n";
 	  }
       }
   }
+  if (timeProfiling)
+    s << "total profiled time: " << totalTime / 1000000.0 << " ms\n\n";
+  showMemoStatistics(s);
+  showUnifierCacheStatistics(s);
+}
+
+double
+ProfileModule::computeItemTimes(ItemTimeMap& itemTimes) const
+{
+  //
+  //	Sum the time for each stack into the item at the top of the stack.
+  //
+  double totalTime = 0;
+  if (timeProfiling)
+    {
+      for (const auto& p : timeMap)
+	{
+	  itemTimes[p.first.back().item] += p.second;
+	  totalTime += p.second;
+	}
+    }
+  return totalTime;
+}
+
+void
+ProfileModule::showProfileJson(ostream& s) const
+{
+  ItemTimeMap itemTimes;
+  double totalTime = computeItemTimes(itemTimes);
+  s << "\"symbols\": [";
+  const char* separator = "\n";
+  {
+    const Vector<Symbol*>& symbols = getSymbols();
+    int nrSymbols = symbolInfo.length();
+    for (int i = 0; i < nrSymbols; i++)
+      {
+	const SymbolProfile& p = symbolInfo[i];
+	if (p.nrBuiltinMbRewrites + p.nrBuiltinEqRewrites +
+	    p.nrBuiltinRlRewrites + p.nrMemoRewrites > 0)
+	  {
+	    ostringstream name;
+	    name << symbols[i];
+	    ostringstream decl;
+	    showSymbol(decl, symbols[i]);
+	    string text = decl.str();
+	    text.pop_back();  // lose newline
+	    s << separator << "{\"name\": ";
+	    printJsonString(s, name.str());
+	    s << ", \"text\": ";
+	    printJsonString(s, text);
+	    s << ", \"builtinMbRewrites\": " << p.nrBuiltinMbRewrites <<
+	      ", \"builtinEqRewrites\": " << p.nrBuiltinEqRewrites <<
+	      ", \"builtinRlRewrites\": " << p.nrBuiltinRlRewrites <<
+	      ", \"memoRewrites\": " << p.nrMemoRewrites;
+	    showTimeJson(s, itemTimes, symbols[i]);
+	    s << '}';
+	    separator = ",\n";
+	  }
+      }
+  }
+  s << "],\n\"statements\": [";
+  separator = "\n";
+  {
+    const Vector<SortConstraint*>& mbs = getSortConstraints();
+    int nrMbs = mbInfo.length();
+    for (int i = 0; i < nrMbs; i++)
+      showStatementJson(s, "mb", mbs[i], mbInfo[i], itemTimes, separator);
+  }
+  {
+    const Vector<Equation*>& eqs = getEquations();
+    int nrEqs = eqInfo.length();
+    for (int i = 0; i < nrEqs; i++)
+      showStatementJson(s, "eq", eqs[i], eqInfo[i], itemTimes, separator);
+  }
+  {
+    const Vector<Rule*>& rls = getRules();
+    int nrRls = rlInfo.length();
+    for (int i = 0; i < nrRls; i++)
+      showStatementJson(s, "rl", rls[i], rlInfo[i], itemTimes, separator);
+  }
+  {
+    const Vector<StrategyDefinition*>& sdefs = getStrategyDefinitions();
+    int nrSdefs = sdInfo.length();
+    for (int i = 0; i < nrSdefs; i++)
+      showStatementJson(s, "sd", sdefs[i], sdInfo[i], itemTimes, separator);
+  }
+  s << ']';
+  if (timeProfiling)
+    s << ",\n\"totalTimeMs\": " << totalTime / 1000000.0;
+  s << ",\n\"memo\": ";
+  showMemoStatisticsJson(s);
+  s << ",\n\"unifierCache\": ";
+  showUnifierCacheStatisticsJson(s);
+}
+
+void
+ProfileModule::showStatementJson(ostream& s,
+				 const char* kind,
+				 const PreEquation* pe,
+				 const StatementProfile& p,
+				 const ItemTimeMap& itemTimes,
+				 const char*& separator)
+{
+  if (p.nrConditionStarts == 0 && p.nrRewrites == 0)
+    return;
+  s << separator << "{\"kind\": \"" << kind << "\", \"label\": ";
+  int label = pe->getLabel().id();
+  if (label == NONE)
+    s << "null";
+  else
+    printJsonString(s, Token::name(label));
+  ostringstream location;
+  location << static_cast<const LineNumber&>(*pe);
+  s << ", \"location\": ";
+  printJsonString(s, location.str());
+  ostringstream text;
+  text << pe;
+  s << ", \"text\": ";
+  printJsonString(s, text.str());
+  s << ", \"rewrites\": " << p.nrRewrites;
+  showTimeJson(s, itemTimes, pe);
+  if (p.nrConditionStarts > 0)
+    {
+      s << ", \"lhsMatches\": " << p.nrConditionStarts << ", \"fragments\": [";
+      Int64 nrFirsts = p.nrConditionStarts;
+      int nrFragments = p.fragmentInfo.length();
+      for (int i = 0; i < nrFragments; i++)
+	{
+	  Int64 nrSuccesses = p.fragmentInfo[i].nrSuccesses;
+	  Int64 nrFailures = p.fragmentInfo[i].nrFailures;
+	  if (i > 0)
+	    s << ", ";
+	  s << "{\"initialTries\": " << nrFirsts <<
+	    ", \"resolveTries\": " << nrSuccesses + nrFailures - nrFirsts <<
+	    ", \"successes\": " << nrSuccesses <<
+	    ", \"failures\": " << nrFailures << '}';
+	  nrFirsts = nrSuccesses;  // for next fragment
+	}
+      s << ']';
+    }
+  s << '}';
+  separator = ",\n";
+}
+
+void
+ProfileModule::showTimeJson(ostream& s, const ItemTimeMap& itemTimes, const void* item)
+{
+  if (timeProfiling)
+    {
+      ItemTimeMap::const_iterator i = itemTimes.find(item);
+      s << ", \"timeMs\": " << (i == itemTimes.end() ? 0.0 : i->second / 1000000.0);
+    }
+}
+
+void
+ProfileModule::printJsonString(ostream& s, const string& text)
+{
+  s << '"';
+  for (char c : text)
+    {
+      switch (c)
+	{
+	case '"':
+	  {
+	    s << "\\\"";
+	    break;
+	  }
+	case '\\':
+	  {
+	    s << "\\\\";
+	    break;
+	  }
+	case '\n':
+	  {
+	    s << "\\n";
+	    break;
+	  }
+	case '\t':
+	  {
+	    s << "\\t";
+	    break;
+	  }
+	default:
+	  {
+	    if (static_cast<unsigned char>(c) < 0x20)
+	      {
+		static const char hexDigits[] = "0123456789abcdef";
+		s << "\\u00" << hexDigits[c >> 4] << hexDigits[c & 0xf];
+	      }
+	    else
+	      s << c;
+	  }
+	}
+    }
+  s << '"';
 }
 
 void
@@ -25,6 +25,8 @@
 //
 #ifndef _profileModule_hh_
 #define _profileModule_hh_
+#include <map>
+#include <vector>
 #include "module.hh"
 
 class ProfileModule : public Module
@@ -45,6 +47,27 @@ public:
   void profileSdConditionStart(const StrategyDefinition* sdef);
   void profileFragment(const PreEquation* preEquation, int fragmentIndex, bool success);
   void showProfile(ostream& s) const;
+  //
+  //	Machine-readable version of showProfile(); prints the members of a
+  //	JSON object, which the caller is expected to open and close.
+  //
+  void showProfileJson(ostream& s) const;
+  static void printJsonString(ostream& s, const string& text);
+  //
+  //	Profiled time as folded stacks for flame graphs.
+  //
+  void showFoldedStacks(ostream& s) const;
+  //
+  //	Optional wall-clock time attribution. trials holds the statements whose
+  //	conditions we are inside, innermost first; item is the statement that
+  //	was tried or applied, or the symbol for a built-in or memo rewrite, with
+  //	type a RewritingContext::RewriteType.
+  //
+  static void setTimeProfiling(bool polarity);
+  static bool getTimeProfiling();
+  static void resetTimeBase();
+  void profileTime(const Vector<const PreEquation*>& trials, const void* item, int type);
+  void profileTimeContinued();
 
 private:
   struct SymbolProfile
@@ -78,16 +101,69 @@ private:
     Vector<FragmentProfile> fragmentInfo;
   };
 
+  struct Frame
+  {
+    bool operator<(const Frame& other) const;
+
+    const void* item;
+    int type;
+  };
+
+  typedef vector<Frame> FrameStack;
+  typedef map<FrameStack, Int64> TimeMap;
+  typedef map<const void*, Int64> ItemTimeMap;
+
   static void showSymbol(ostream& s, Symbol* op);
   static void showFragmentProfile(ostream& s,
 				  const Vector<FragmentProfile>& fragmentInfo,
 				  Int64 nrFirsts);
+  static void showTime(ostream& s, const ItemTimeMap& itemTimes, const void* item, double totalTime);
+  static void showStatementJson(ostream& s,
+				const char* kind,
+				const PreEquation* pe,
+				const StatementProfile& p,
+				const ItemTimeMap& itemTimes,
+				const char*& separator);
+  static void showTimeJson(ostream& s, const ItemTimeMap& itemTimes, const void* item);
+  double computeItemTimes(ItemTimeMap& itemTimes) const;
+  static void printFrame(ostream& s, const Frame& frame);
+  static void printFoldedFrame(ostream& s, const string& name);
+  static Int64 elapsedTime();
+
+  static bool timeProfiling;
+  static Int64 lastTime;  // nanoseconds, or 0 if not yet started
 
   Vector<SymbolProfile> symbolInfo;
   Vector<StatementProfile> mbInfo;
   Vector<StatementProfile> eqInfo;
   Vector<StatementProfile> rlInfo;
   Vector<StatementProfile> sdInfo;
+  TimeMap timeMap;
+  TimeMap::iterator lastCharge;  // where to charge time after a rewrite; end() if none
 };
 
+inline bool
+ProfileModule::Frame::operator<(const Frame& other) const
+{
+  return item < other.item || (item == other.item && type < other.type);
+}
+
+inline void
+ProfileModule::setTimeProfiling(bool polarity)
+{
+  timeProfiling = polarity;
+}
+
+inline bool
+ProfileModule::getTimeProfiling()
+{
+  return timeProfiling;
+}
+
+inline void
+ProfileModule::resetTimeBase()
+{
+  lastTime = 0;
+}
+
 #endif
@@ -507,22 +507,22 @@ Interpreter::showSearchGraph()
   if (xmlBuffer != 0 && getFlag(SHOW_COMMAND))
     xmlBuffer->generateShowSearchGraph();
   int nrStates = savedRewriteSequenceSearch->getNrStates();
+  Vector<RewriteSequenceSearch::Arc> arcs;
   for (int i = 0; i < nrStates; i++)
     {
       if (i > 0)
 	cout << '\n';
       DagNode* d = savedRewriteSequenceSearch->getStateDag(i);
       cout << "state " << i << ", " << d->getSort() << ": " << d << '\n';
-      const RewriteSequenceSearch::ArcMap& fwdArcs =
-	savedRewriteSequenceSearch->getStateFwdArcs(i);
+      savedRewriteSequenceSearch->getSortedArcs(i, arcs);
+      int nrArcs = arcs.size();
       int arcNr = 0;
-      for (RewriteSequenceSearch::ArcMap::const_iterator j = fwdArcs.begin();
-	   j != fwdArcs.end(); j++, arcNr++)
+      for (int j = 0; j < nrArcs; arcNr++)
 	{
-	  cout << "arc " << arcNr << " ===> state " << (*j).first;
-	  const set<Rule*>& r = (*j).second;
-	  for (set<Rule*>::const_iterator k = r.begin(); k != r.end(); k++)
-	    cout << " (" << *k << ')';
+	  int nextState = arcs[j].nextState;
+	  cout << "arc " << arcNr << " ===> state " << nextState;
+	  for (; j < nrArcs && arcs[j].nextState == nextState; j++)
+	    cout << " (" << arcs[j].rule << ')';
 	  cout << '\n';
 	}
     }
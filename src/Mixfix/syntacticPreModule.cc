@@ -170,10 +170,18 @@ SyntacticPreModule::getFlatModule()
       //	have been compiled since it relied on VariableInfo being filled out.
       //
       m->checkFreshVariableNames();
+      m->loadMemoCache();
     }
   return m;
 }
 
+void
+SyntacticPreModule::saveMemoCache()
+{
+  if (flatModule != 0)
+    flatModule->saveMemoCache();
+}
+
 VisibleModule*
 SyntacticPreModule::getFlatSignature() 
 {
@@ -96,6 +96,7 @@ public:
 
   VisibleModule* getFlatSignature() override;
   VisibleModule* getFlatModule() override;
+  void saveMemoCache() override;
 
   const ModuleDatabase::ImportMap* getAutoImports() const override;
 
@@ -42,6 +42,7 @@ StringTable Token::stringTable;
 Vector<int> Token::specialProperties;
 Vector<int> Token::auxProperties;
 Vector<char> Token::buffer;
+Vector<Token::MixfixInfo> Token::mixfixInfo;
 
 ostream&
 operator<<(ostream& s, const Token& token)
@@ -262,6 +263,22 @@ Token::prettyOpName(int prefixNameCode)
 
 int
 Token::extractMixfix(int prefixNameCode, Vector<int>& mixfixSyntax)
+{
+  //
+  //	Every module that imports an operator extracts its mixfix syntax
+  //	again, so we cache the result for each prefix name.
+  //
+  if (prefixNameCode >= mixfixInfo.length())
+    mixfixInfo.resize(specialProperties.length());
+  MixfixInfo& info = mixfixInfo[prefixNameCode];
+  if (info.nrUnderscores == NONE)
+    info.nrUnderscores = computeMixfix(prefixNameCode, info.mixfixSyntax);
+  mixfixSyntax = info.mixfixSyntax;  // deep copy
+  return info.nrUnderscores;
+}
+
+int
+Token::computeMixfix(int prefixNameCode, Vector<int>& mixfixSyntax)
 {
   int sp = specialProperties[prefixNameCode];
   if (sp != NONE && sp != CONTAINS_COLON && sp != ENDS_IN_COLON && sp != ITER_SYMBOL)
@@ -140,17 +140,27 @@ private:
       FLAG_BIT = 0x40000000	// we set this bit to create flagged codes
     };
 
+  struct MixfixInfo
+  {
+    MixfixInfo() : nrUnderscores(NONE) {}
+
+    int nrUnderscores;		// NONE if not yet computed
+    Vector<int> mixfixSyntax;
+  };
+
   static void checkForSpecialProperty(const char* tokenString);
   static int computeSpecialProperty(const char* tokenString);
   static int computeAuxProperty(const char* tokenString);
   static const char* skipSortName(const char* tokenString, bool& parameterized);
   static bool looksLikeRational(const char* s);
   static bool hasNonAlphanumeric(const char* name);
+  static int computeMixfix(int prefixNameCode, Vector<int>& mixfixSyntax);
 
   static StringTable stringTable;
   static Vector<int> specialProperties;
   static Vector<int> auxProperties;
   static Vector<char> buffer;
+  static Vector<MixfixInfo> mixfixInfo;
 
   int codeNr;
   int lineNr;
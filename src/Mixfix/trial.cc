@@ -31,8 +31,13 @@ UserLevelRewritingContext::traceBeginEqTrial(DagNode* subject, const Equation* e
   Assert(equation != 0, "null equation in trial");
   if (interpreter.getFlag(Interpreter::PROFILE))
     {
-      safeCast(ProfileModule*, root()->symbol()->getModule())->
-	profileEqConditionStart(equation);
+      ProfileModule* module = safeCast(ProfileModule*, root()->symbol()->getModule());
+      module->profileEqConditionStart(equation);
+      if (ProfileModule::getTimeProfiling())
+	{
+	  profileTime(module, equation, RewritingContext::NORMAL);
+	  currentTrial = equation;
+	}
     }
   if (handleDebug(subject, equation))
     return UNDEFINED;
@@ -50,8 +55,13 @@ UserLevelRewritingContext::traceBeginRuleTrial(DagNode* subject, const Rule* rul
   Assert(rule != 0, "null rule in trial");
   if (interpreter.getFlag(Interpreter::PROFILE))
     {
-      safeCast(ProfileModule*, root()->symbol()->getModule())->
-	profileRlConditionStart(rule);
+      ProfileModule* module = safeCast(ProfileModule*, root()->symbol()->getModule());
+      module->profileRlConditionStart(rule);
+      if (ProfileModule::getTimeProfiling())
+	{
+	  profileTime(module, rule, RewritingContext::NORMAL);
+	  currentTrial = rule;
+	}
     }
   if (handleDebug(subject, rule))
     return UNDEFINED;
@@ -69,8 +79,13 @@ UserLevelRewritingContext::traceBeginScTrial(DagNode* subject, const SortConstra
   Assert(sc != 0, "null membership axiom in trial");
   if (interpreter.getFlag(Interpreter::PROFILE))
     {
-      safeCast(ProfileModule*, root()->symbol()->getModule())->
-	profileMbConditionStart(sc);
+      ProfileModule* module = safeCast(ProfileModule*, root()->symbol()->getModule());
+      module->profileMbConditionStart(sc);
+      if (ProfileModule::getTimeProfiling())
+	{
+	  profileTime(module, sc, RewritingContext::NORMAL);
+	  currentTrial = sc;
+	}
     }
   if (handleDebug(subject, sc))
     return UNDEFINED;
@@ -88,8 +103,13 @@ UserLevelRewritingContext::traceBeginSdTrial(DagNode* subject, const StrategyDef
   Assert(sdef != 0, "null strategy definition in trial");
   if (interpreter.getFlag(Interpreter::PROFILE))
     {
-        safeCast(ProfileModule*, root()->symbol()->getModule())->
-	profileSdConditionStart(sdef);
+      ProfileModule* module = safeCast(ProfileModule*, root()->symbol()->getModule());
+      module->profileSdConditionStart(sdef);
+      if (ProfileModule::getTimeProfiling())
+	{
+	  profileTime(module, sdef, RewritingContext::NORMAL);
+	  currentTrial = sdef;
+	}
     }
   if (handleDebug(subject, sdef))
     return UNDEFINED;
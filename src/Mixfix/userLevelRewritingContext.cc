@@ -39,6 +39,7 @@
 #include "variable.hh"
 #include "strategyLanguage.hh"
 #include "mixfix.hh"
+#include "meta.hh"
 
 //      interface class definitions
 #include "symbol.hh"
@@ -66,6 +67,7 @@
 #include "userLevelRewritingContext.hh"
 //#include "preModule.hh"  // HACK
 #include "autoWrapBuffer.hh"
+#include "metaModuleCache.hh"
 
 #include "interpreter.hh"  // HACK
 #include "global.hh"  // HACK shouldn't be accessing global variables
@@ -83,7 +85,8 @@ UserLevelRewritingContext::UserLevelRewritingContext(DagNode* root)
   : ObjectSystemRewritingContext(root),
     parent(0),
     purpose(TOP_LEVEL_EVAL),
-    localTraceFlag(true)
+    localTraceFlag(true),
+    currentTrial(0)
 {
 }
 
@@ -94,7 +97,8 @@ UserLevelRewritingContext::UserLevelRewritingContext(DagNode* root,
   : ObjectSystemRewritingContext(root),
     parent(parent),
     purpose(purpose),
-    localTraceFlag(localTraceFlag)
+    localTraceFlag(localTraceFlag),
+    currentTrial(0)
 {
 }
 
@@ -106,6 +110,29 @@ UserLevelRewritingContext::makeSubcontext(DagNode* root, int purpose)
 				       (purpose != CONDITION_EVAL || interpreter.getFlag(Interpreter::TRACE_CONDITION)));
 }
 
+void
+UserLevelRewritingContext::profileTime(ProfileModule* module, const void* item, int type)
+{
+  //
+  //	The statements whose conditions we are solving belong to the contexts
+  //	above us. We skip those from other modules (reached via the metalevel)
+  //	since they may not outlive the profile we are adding to.
+  //
+  static Vector<const PreEquation*> trials;
+  trials.clear();
+  for (UserLevelRewritingContext* c = parent; c != 0; c = c->parent)
+    {
+      const PreEquation* pe = c->currentTrial;
+      if (pe != 0 && pe->getModule() == module)
+	trials.append(pe);
+    }
+  module->profileTime(trials, item, type);
+  //
+  //	Any condition we were solving in this context is finished.
+  //
+  currentTrial = 0;
+}
+
 bool
 UserLevelRewritingContext::dontTrace(const DagNode* redex, const PreEquation* pe)
 {
@@ -157,8 +184,15 @@ UserLevelRewritingContext::tracePreEqRewrite(DagNode* redex,
   //
   if (interpreter.getFlag(Interpreter::PROFILE))
     {
-      safeCast(ProfileModule*, root()->symbol()->getModule())->
-	profileEqRewrite(redex, equation, type);
+      ProfileModule* module = safeCast(ProfileModule*, root()->symbol()->getModule());
+      module->profileEqRewrite(redex, equation, type);
+      if (ProfileModule::getTimeProfiling())
+	{
+	  if (equation == 0)
+	    profileTime(module, redex->symbol(), type);
+	  else
+	    profileTime(module, equation, RewritingContext::NORMAL);
+	}
     }
   if (interpreter.getFlag(Interpreter::PRINT_ATTRIBUTE))
     checkForPrintAttribute(MetadataStore::EQUATION, equation);
@@ -213,6 +247,8 @@ UserLevelRewritingContext::tracePreEqRewrite(DagNode* redex,
 void
 UserLevelRewritingContext::tracePostEqRewrite(DagNode* replacement)
 {
+  if (interpreter.getFlag(Interpreter::PROFILE) && ProfileModule::getTimeProfiling())
+    safeCast(ProfileModule*, root()->symbol()->getModule())->profileTimeContinued();
   if (tracePostFlag)
     {
       Assert(!abortFlag, "abort flag set");
@@ -240,8 +276,15 @@ UserLevelRewritingContext::tracePreRuleRewrite(DagNode* redex, const Rule* rule)
 
   if (interpreter.getFlag(Interpreter::PROFILE))
     {
-      safeCast(ProfileModule*, root()->symbol()->getModule())->
-	profileRlRewrite(redex, rule);
+      ProfileModule* module = safeCast(ProfileModule*, root()->symbol()->getModule());
+      module->profileRlRewrite(redex, rule);
+      if (ProfileModule::getTimeProfiling())
+	{
+	  if (rule == 0)
+	    profileTime(module, redex->symbol(), RewritingContext::BUILTIN);
+	  else
+	    profileTime(module, rule, RewritingContext::NORMAL);
+	}
     }
   if (interpreter.getFlag(Interpreter::PRINT_ATTRIBUTE))
     checkForPrintAttribute(MetadataStore::RULE, rule);
@@ -285,6 +328,8 @@ UserLevelRewritingContext::tracePreRuleRewrite(DagNode* redex, const Rule* rule)
 void
 UserLevelRewritingContext::tracePostRuleRewrite(DagNode* replacement)
 {
+  if (interpreter.getFlag(Interpreter::PROFILE) && ProfileModule::getTimeProfiling())
+    safeCast(ProfileModule*, root()->symbol()->getModule())->profileTimeContinued();
   if (tracePostFlag)
     {
       if (interpreter.getFlag(Interpreter::TRACE_REWRITE))
@@ -421,7 +466,10 @@ UserLevelRewritingContext::traceStrategyCall(StrategyDefinition* sdef,
 {
   if (interpreter.getFlag(Interpreter::PROFILE))
     {
-      safeCast(ProfileModule*, root()->symbol()->getModule())->profileSdRewrite(subject, sdef);
+      ProfileModule* module = safeCast(ProfileModule*, root()->symbol()->getModule());
+      module->profileSdRewrite(subject, sdef);
+      if (ProfileModule::getTimeProfiling())
+	profileTime(module, sdef, RewritingContext::NORMAL);
     }
   if (interpreter.getFlag(Interpreter::PRINT_ATTRIBUTE))
     checkForPrintAttribute(MetadataStore::STRAT_DEF, sdef);
@@ -472,8 +520,15 @@ UserLevelRewritingContext::tracePreScApplication(DagNode* subject, const SortCon
 {
   if (interpreter.getFlag(Interpreter::PROFILE))
     {
-      safeCast(ProfileModule*, root()->symbol()->getModule())->
-	profileMbRewrite(subject, sc);
+      ProfileModule* module = safeCast(ProfileModule*, root()->symbol()->getModule());
+      module->profileMbRewrite(subject, sc);
+      if (ProfileModule::getTimeProfiling())
+	{
+	  if (sc == 0)
+	    profileTime(module, subject->symbol(), RewritingContext::BUILTIN);
+	  else
+	    profileTime(module, sc, RewritingContext::NORMAL);
+	}
     }
   if (interpreter.getFlag(Interpreter::PRINT_ATTRIBUTE))
     checkForPrintAttribute(MetadataStore::MEMB_AX, sc);
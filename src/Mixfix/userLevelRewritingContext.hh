@@ -166,6 +166,7 @@ private:
   void where(ostream& s);
   void printStatusReportCommon();
   void printStatusReport(DagNode* subject, const PreEquation* pe);
+  void profileTime(ProfileModule* module, const void* item, int type);
 
   static bool tracePostFlag;
   static int trialCount;
@@ -192,6 +193,7 @@ private:
   UserLevelRewritingContext* parent;
   const int purpose;
   bool localTraceFlag;
+  const PreEquation* currentTrial;  // statement whose condition we are solving, for time profiling
 };
 
 inline void
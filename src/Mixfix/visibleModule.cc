@@ -23,6 +23,8 @@
 //
 //      Implementation for class VisibleModule.
 //
+#include <fstream>
+#include <sstream>
 
 //      utility stuff
 #include "macros.hh"
@@ -41,8 +43,12 @@
 #include "term.hh"
 #include "binarySymbol.hh"
 #include "variableSymbol.hh"
+#include "dagArgumentIterator.hh"
 
 //      core class definitions
+#include "dagRoot.hh"
+#include "memoMap.hh"
+#include "rewritingContext.hh"
 #include "equation.hh"
 #include "rule.hh"
 #include "rewriteStrategy.hh"
@@ -75,11 +81,13 @@
 //	our stuff
 #include "latexModulePrint.cc"
 #include "latexStrategyPrint.cc"
+#include "memoCache.cc"
 
 VisibleModule::VisibleModule(int name, ModuleType moduleType, Interpreter* owner)
   : ImportModule(name, moduleType),
     owner(owner)
 {
+  memoCacheLoaded = false;
 }
 
 void
@@ -49,6 +49,13 @@ public:
   void showRls(ostream& s, bool indent, bool all) const;
   void showStrats(ostream& s, bool indent, bool all) const;
   void showSds(ostream& s, bool indent, bool all) const;
+  //
+  //	Persistent memo tables; only active once a cache directory has been set.
+  //
+  void loadMemoCache();
+  void saveMemoCache();
+  void unloadMemoCache();
+  static void setMemoCacheDirectory(const char* directory);
 
   void latexShowSummary(ostream& s);
   void latexShowKinds(ostream& s) const;
@@ -104,7 +111,16 @@ private:
   static void latexPrintCondition(ostream& s, const PreEquation* pe);
   static void latexPrintViewName(ostream& s, View* view);
   
+  void makeMemoCacheFileName();
+  static string makeMemoCacheHeader();
+  static bool readDag(istream& in, size_t length, string& buffer);
+  static bool wellKinded(DagNode* dagNode, PointerSet& visited);
+
+  static string memoCacheDirectory;
+
   Interpreter* const owner;
+  string memoCacheFile;  // empty if we don't have a memo cache
+  bool memoCacheLoaded;  // set once we have tried to load our memo cache
 };
 
 inline Interpreter*
@@ -160,7 +160,15 @@ ObjectSystemRewritingContext::externalRewrite()
       //	current state, so if there are external events pending we
       //	block on them.
       //
-      //	But first we need to deal with any signals that have
+      //	If we are going to sit idle, this is a good moment for a
+      //	garbage collection that would otherwise interrupt the handling
+      //	of whatever event wakes us. Everything we hold is reachable
+      //	from our root container.
+      //
+      if (PseudoThread::eventsPending())
+	MemoryCell::idleCollectGarbage();
+      //
+      //	Before blocking we need to deal with any signals that have
       //	been delivered and then block them so we don't miss them by their
       //	being delivered before we make our blocking system call.
       //
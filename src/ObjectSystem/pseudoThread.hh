@@ -107,6 +107,11 @@ public:
   //
   static int eventLoop(bool block = true, sigset_t* normalSet = 0);
   //
+  //	Return true if any client is waiting on an fd, a child exit or
+  //	a timed callback, so that a blocking eventLoop() call could sleep.
+  //
+  static bool eventsPending();
+  //
   //	Clear any requests for callbacks on a given fd.
   //
   static void clearFlags(int fd);
@@ -188,6 +193,12 @@ private:
   static bool exitedFlag;
 };
 
+inline bool
+PseudoThread::eventsPending()
+{
+  return firstActive != NONE || !(childRequests.empty()) || !(callbackMap.empty());
+}
+
 inline
 PseudoThread::CallbackRequest::CallbackRequest(PseudoThread* client, long clientData)
   : client(client),
@@ -73,7 +73,7 @@ Parser::buildTerminalDecisionTrees()
       //
       //	Make a decision tree by divid-and-conqueor.
       //
-      terminalDecisionTrees[i] = buildDecisionTree(ruleTable, starts, 0, starts.length() - 1);
+      terminalDecisionTrees[i] = buildDecisionTree(ruleTable, starts, 0, starts.length() - 1, 0);
     }
 }
 
@@ -81,58 +81,109 @@ void
 Parser::buildNonTerminalDecisionTrees()
 {
   Vector<Rule*> ruleTable;
+  Vector<Rule*> lookaheadTable;
   Vector<int> starts;
   int nrNonTerminals = firstTerminalRules.length();
   nonTerminalDecisionTrees.resize(nrNonTerminals);
+  startUpGroups.clear();
   for (int i = 0; i < nrNonTerminals; i++)
     {
       //
-      //	Collect all the terminal rules that have i as the nonterminal.
-      //	We use pointers rather than indices for ruleLt.
+      //	Collect all the nonterminal rules that have i as the nonterminal.
+      //	We use pointers rather than indices for startUpLt.
       //
       ruleTable.clear();
       for (int r = firstNonTerminalRules[i]; r != NONE; r = rules[r].nextRule)
 	ruleTable.append(&(rules[r]));
       //
-      //	Sort them by rhs start symbol, then prec, smallest first.
+      //	Sort them by rhs start symbol, then lookahead terminal, then prec,
+      //	smallest first. Rules without a lookahead terminal come first for
+      //	each rhs start symbol.
       //
-      sort(ruleTable.begin(), ruleTable.end(), ruleLt);
+      sort(ruleTable.begin(), ruleTable.end(), startUpLt);
       //
-      //	Make a list of the index in ruleTable of the first production
-      //	for each rhs start symbol.
+      //	Make a start up group for each rhs start symbol.
       //
+      int firstGroup = startUpGroups.size();
       int nrRules = ruleTable.length();
-      int lastSymbol = UNBOUNDED;  // bigger than any terminal symbol
-      starts.clear();
-      for (int j = 0; j < nrRules; j++)
+      for (int j = 0; j < nrRules;)
 	{
-	  if (ruleTable[j]->rhs[0].symbol != lastSymbol)
+	  int startSymbol = ruleTable[j]->rhs[0].symbol;
+	  startUpGroups.push_back({startSymbol, NONE, NONE, NONE, NONE, {}});
+	  StartUpGroup& g = startUpGroups.back();
+	  //
+	  //	Rules without a lookahead terminal are linked by increasing prec.
+	  //
+	  Rule* last = 0;
+	  for (; j < nrRules && ruleTable[j]->rhs[0].symbol == startSymbol &&
+		 lookaheadTerminal(ruleTable[j]) == NONE; ++j)
 	    {
-	      lastSymbol = ruleTable[j]->rhs[0].symbol;
-	      starts.append(j);
+	      int index = ruleTable[j] - rules.data();  // compute index in rules[] by pointer subtraction
+	      if (last == 0)
+		g.firstRule = index;
+	      else
+		last->equal = index;
+	      last = ruleTable[j];
+	    }
+	  if (last != 0)
+	    last->equal = NONE;
+	  //
+	  //	Rules with a lookahead terminal go in a decision tree on that terminal.
+	  //
+	  lookaheadTable.clear();
+	  starts.clear();
+	  int lastSymbol = NONE;
+	  for (; j < nrRules && ruleTable[j]->rhs[0].symbol == startSymbol; ++j)
+	    {
+	      Rule* r = ruleTable[j];
+	      if (r->rhs[1].symbol != lastSymbol)
+		{
+		  lastSymbol = r->rhs[1].symbol;
+		  starts.append(lookaheadTable.length());
+		}
+	      lookaheadTable.append(r);
+	      g.lookaheadPrecs.push_back(IntPair(r->prec, r->rhs[0].prec));
 	    }
+	  g.lookaheadTree = buildDecisionTree(lookaheadTable, starts, 0, starts.length() - 1, 1);
+	  //
+	  //	We only need the distinct (prec, rhs[0].prec) pairs, by increasing prec,
+	  //	to decide if any lookahead rule could be started by a return.
+	  //
+	  sort(g.lookaheadPrecs.begin(), g.lookaheadPrecs.end());
+	  g.lookaheadPrecs.contractTo(unique(g.lookaheadPrecs.begin(), g.lookaheadPrecs.end()) - g.lookaheadPrecs.begin());
 	}
-      nonTerminalDecisionTrees[i] = buildDecisionTree(ruleTable, starts, 0, starts.length() - 1);
+      nonTerminalDecisionTrees[i] = buildStartUpTree(firstGroup, startUpGroups.size() - 1);
     }
 }
 
 int
-Parser::buildDecisionTree(Vector<Rule*>& ruleTable, Vector<int>& starts, int first, int last)
+Parser::buildStartUpTree(int first, int last)
+{
+  if (first > last)
+    return NONE;
+  int i = (first + last) / 2;
+  startUpGroups[i].smaller = buildStartUpTree(first, i - 1);
+  startUpGroups[i].bigger = buildStartUpTree(i + 1, last);
+  return i;
+}
+
+int
+Parser::buildDecisionTree(Vector<Rule*>& ruleTable, Vector<int>& starts, int first, int last, int position)
 {
   if (first > last)
     return NONE;
   int i = (first + last) / 2;
   int j = starts[i]; 
-  ruleTable[j]->smaller = buildDecisionTree(ruleTable, starts, first, i - 1);
+  ruleTable[j]->smaller = buildDecisionTree(ruleTable, starts, first, i - 1, position);
   int k = j;
   int end = ruleTable.length() - 1;
   for (; k < end; k++)
     {
-      if (ruleTable[k]->rhs[0].symbol != ruleTable[k + 1]->rhs[0].symbol)
+      if (ruleTable[k]->rhs[position].symbol != ruleTable[k + 1]->rhs[position].symbol)
 	break;
       ruleTable[k]->equal = ruleTable[k + 1] - rules.data();  // compute index in rules[] by pointer subtraction
     }
   ruleTable[k]->equal = NONE;
-  ruleTable[j]->bigger = buildDecisionTree(ruleTable, starts, i + 1, last);
+  ruleTable[j]->bigger = buildDecisionTree(ruleTable, starts, i + 1, last, position);
   return ruleTable[j] - rules.data();  // compute index in rules[] by pointer subtraction
 }
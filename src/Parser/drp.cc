@@ -217,16 +217,16 @@ Parser::extractOneStepOfDeterministicReductionPath(int ruleNr, int startTokenNr)
       //
       //	Check for implied start ups.
       //
-      int r = nonTerminalDecisionTrees[flip(nonTerminal2)];
-      while (r != NONE)
+      int g = findStartUpGroup(nonTerminal2, nonTerminal);
+      if (g == NONE)
+	continue;
+      StartUpGroup& group = startUpGroups[g];
+      if (firstLookaheadPrec(group, maxPrec, prec) != NONE)
 	{
-	  Rule& rule2 = rules[r];
-	  int t = nonTerminal - rule2.rhs[0].symbol;
-	  if (t == 0)
-	    break;
-	  r = (t > 0) ? rule2.bigger : rule2.smaller;
+	  ParserLog("********> end of DRP seen because of non return event - implied start up with lookahead");
+	  return IntPair(NONE, NONE);
 	}
-
+      int r = group.firstRule;
       while (r != NONE)
 	{
 	  Rule& rule2 = rules[r];
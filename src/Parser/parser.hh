@@ -174,21 +174,40 @@ private:
     int nextSibling;
   };
 
-  static int flip(int i);
-  static bool ruleLt(Rule* const& r1, Rule* const& r2);
-
   typedef pair<int, int> IntPair;
   typedef pair<int, bool> IntBoolPair;
   typedef map<int, int> SymbolToPrecMap;
   typedef map<int, SymbolToPrecMap> PrecToExpansionMap;
   typedef Vector<PrecToExpansionMap> Expansions; 
+
+  struct StartUpGroup
+  {
+    //
+    //	The rules <nonTerminal2> ::= <nonTerminal> ... for some <nonTerminal2> and
+    //	a given <nonTerminal>. A rule whose second rhs symbol is a terminal can only
+    //	be advanced by a return if that terminal is the next token, so such rules are
+    //	kept in a decision tree on that terminal and are never visited otherwise.
+    //
+    int nonTerminal;
+    int smaller;			// | indices of groups for 2 branches of decision tree
+    int bigger;				// |
+    int firstRule;			// first rule without a lookahead terminal; rules are linked by equal
+    int lookaheadTree;			// decision tree on rhs[1] for rules with a lookahead terminal
+    Vector<IntPair> lookaheadPrecs;	// distinct (prec, rhs[0].prec) for rules with a lookahead terminal
+  };
+
+  static int flip(int i);
+  static int lookaheadTerminal(const Rule* r);
+  static bool ruleLt(Rule* const& r1, Rule* const& r2);
+  static bool startUpLt(Rule* const& r1, Rule* const& r2);
   //
   //	Compile
   //
   void buildExpansionTables();
   void buildTerminalDecisionTrees();
   void buildNonTerminalDecisionTrees();
-  int buildDecisionTree(Vector<Rule*>& ruleTable, Vector<int>& starts, int first, int last);
+  int buildDecisionTree(Vector<Rule*>& ruleTable, Vector<int>& starts, int first, int last, int position);
+  int buildStartUpTree(int first, int last);
   bool mergeInMap(SymbolToPrecMap& target, const SymbolToPrecMap& donor, int targetNonterminal, int targetPrec);
   int makeExpansionList(const SymbolToPrecMap mapForm, int nonterminal);
   void dumpMap(PrecToExpansionMap& m, int nonterminal);
@@ -206,6 +225,8 @@ private:
 		   const Vector<int>& sentence);
   void makeCall(int tokenNr, int ruleNr, int rhsPosition, int startTokenNr);
   bool makeReturn(int tokenNr, int ruleNr, int startTokenNr);
+  int findStartUpGroup(int nonTerminal2, int nonTerminal) const;
+  static int firstLookaheadPrec(const StartUpGroup& group, int maxPrec, int prec);
   IntPair chaseDeterministicReductionPath(int ruleNr, int startTokenNr);
   int makeMemoItem(int nonTerminal, int maxPrec, int ruleNr, int startTokenNr, int nextMemoItem);
   void processBubble(int tokenNr, int bubbleNr, const Vector<int>& sentence);
@@ -245,7 +266,8 @@ private:
   Vector<Rule> rules;			// all the grammar rules
   Vector<Vector<Expansion> > expansions;	// table of expansions for each nonterminal
   Vector<int> terminalDecisionTrees;
-  Vector<int> nonTerminalDecisionTrees;
+  Vector<int> nonTerminalDecisionTrees;	// index into startUpGroups for each nonterminal
+  Vector<StartUpGroup> startUpGroups;
   int firstRealCall;  // index of first call that isn't used for expansion tables
   //
   //	Parse time structures.
@@ -270,6 +292,63 @@ Parser::flip(int i)
   return ~i;  // map nonTerminal number <-> vector index
 }
 
+inline int
+Parser::lookaheadTerminal(const Rule* r)
+{
+  //
+  //	Return the terminal that must follow rhs[0] for r to make progress
+  //	or NONE if there isn't one.
+  //
+  return (r->rhs.size() > 1 && r->rhs[1].symbol >= 0) ? r->rhs[1].symbol : NONE;
+}
+
+inline bool
+Parser::startUpLt(Rule* const& r1, Rule* const& r2)
+{
+  int r = r1->rhs[0].symbol - r2->rhs[0].symbol;
+  if (r != 0)
+    return r < 0;
+  r = lookaheadTerminal(r1) - lookaheadTerminal(r2);
+  if (r != 0)
+    return r < 0;
+  return r1->prec < r2->prec;
+}
+
+inline int
+Parser::findStartUpGroup(int nonTerminal2, int nonTerminal) const
+{
+  //
+  //	Find the group of rules <nonTerminal2> ::= <nonTerminal> ...
+  //
+  int g = nonTerminalDecisionTrees[flip(nonTerminal2)];
+  while (g != NONE)
+    {
+      const StartUpGroup& group = startUpGroups[g];
+      int t = nonTerminal - group.nonTerminal;
+      if (t == 0)
+	break;
+      g = (t > 0) ? group.bigger : group.smaller;
+    }
+  return g;
+}
+
+inline int
+Parser::firstLookaheadPrec(const StartUpGroup& group, int maxPrec, int prec)
+{
+  //
+  //	Return the smallest prec of a rule with a lookahead terminal in group that
+  //	could be started by a return of prec under a call of maxPrec, or NONE.
+  //
+  for (const IntPair& p : group.lookaheadPrecs)
+    {
+      if (p.first > maxPrec)
+	break;
+      if (p.second >= prec)
+	return p.first;
+    }
+  return NONE;
+}
+
 inline bool
 Parser::ruleLt(Rule* const& r1, Rule* const& r2)
 {
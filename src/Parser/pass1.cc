@@ -207,16 +207,18 @@ Parser::processReturn(int tokenNr, int startTokenNr, int ruleNr, const Vector<in
       //	and see if we have nonTerminal2 ::= nonTerminal ...
       //	where the prec for nonTerminal is >= the prec of the rule we just recognized.
       //
-      int r = nonTerminalDecisionTrees[flip(nonTerminal2)];
-      while (r != NONE)
-	{
-	  Rule& rule2 = rules[r];
-	  int t = nonTerminal - rule2.rhs[0].symbol;
-	  if (t == 0)
-	    break;
-	  r = (t > 0) ? rule2.bigger : rule2.smaller;
-	}
-      while (r != NONE)
+      int g = findStartUpGroup(nonTerminal2, nonTerminal);
+      if (g == NONE)
+	continue;
+      StartUpGroup& group = startUpGroups[g];
+      //
+      //	Rules with a lookahead terminal are continuations that rule out a DRP, whether
+      //	or not the next token lets them advance. We note the prec at which the first
+      //	of them would have been seen so DRP decisions are made as if we had visited
+      //	them in prec order.
+      //
+      int lookaheadPrec = drpPossible ? firstLookaheadPrec(group, maxPrec, prec) : NONE;
+      for (int r = group.firstRule; r != NONE;)
 	{
 	  Rule& rule2 = rules[r];
 	  if (rule2.prec > maxPrec)
@@ -235,6 +237,11 @@ Parser::processReturn(int tokenNr, int startTokenNr, int ruleNr, const Vector<in
 	      r = rule2.equal;
 	      continue;
 	    }
+	  if (lookaheadPrec != NONE && rule2.prec > lookaheadPrec)
+	    {
+	      drpPossible = false;
+	      lookaheadPrec = NONE;
+	    }
 	  ParserLog("saw implied call by rule=" << r);
 	  //
 	  //	Normal processesing.
@@ -271,6 +278,35 @@ Parser::processReturn(int tokenNr, int startTokenNr, int ruleNr, const Vector<in
 	    }
 	  r = rule2.equal;
 	}
+      if (lookaheadPrec != NONE)
+	drpPossible = false;
+      //
+      //	Now the rules whose lookahead terminal is the next token.
+      //
+      if (tokenNr == sentence.length())
+	continue;
+      int r = group.lookaheadTree;
+      int token = sentence[tokenNr];
+      while (r != NONE)
+	{
+	  Rule& rule2 = rules[r];
+	  int t = token - rule2.rhs[1].symbol;
+	  if (t == 0)
+	    break;
+	  r = (t > 0) ? rule2.bigger : rule2.smaller;
+	}
+      while (r != NONE)
+	{
+	  Rule& rule2 = rules[r];
+	  if (rule2.prec > maxPrec)
+	    break;
+	  if (rule2.rhs[0].prec >= prec)
+	    {
+	      ParserLog("implied continuation for rule=" << r);
+	      advanceRule(r, 1, startTokenNr, tokenNr, sentence);
+	    }
+	  r = rule2.equal;
+	}
     }
   //
   //	We've now processed all the explicit and implicit callers for (nonterminal, prec)